@@ -1,5 +1,42 @@
 #include "zxcppvbn.hpp"
 
-const size_t zxcppvbn::adjacency_graphs_size = 1369;
+#if ZXCPPVBN_GRAPH_QWERTY
+static const uint8_t qwerty_graph[] = {31,139,8,0,0,0,0,0,2,3,109,148,215,86,91,65,12,69,19,157,47,161,247,222,59,36,132,16,32,133,64,18,66,239,189,25,12,182,41,249,246,108,233,133,229,89,227,7,223,123,53,163,163,173,50,83,40,29,221,21,43,86,175,190,58,73,3,13,186,251,169,163,79,178,102,13,183,98,232,110,209,205,119,157,125,145,181,235,234,171,46,22,117,185,164,206,73,86,172,91,35,205,60,59,118,116,251,195,55,89,127,170,49,172,161,70,12,108,67,224,225,151,108,60,213,152,86,79,13,79,252,74,127,84,88,150,205,234,126,197,125,81,56,158,211,193,71,149,215,100,243,58,249,172,202,95,151,56,95,208,245,55,237,127,144,45,185,16,97,9,62,54,234,114,237,227,178,0,129,25,168,141,103,183,19,201,86,93,13,170,193,109,23,65,10,101,91,211,211,186,199,58,156,245,40,160,108,106,235,85,241,179,93,255,15,48,59,204,241,156,230,120,46,115,60,183,57,158,98,142,167,156,242,188,188,241,212,169,119,154,103,127,189,147,80,40,107,114,41,4,99,71,215,148,172,205,35,240,195,128,217,186,60,62,91,154,106,195,191,47,245,31,242,216,242,14,147,2,12,54,230,96,144,227,140,15,138,248,219,84,181,74,228,14,30,180,143,191,221,16,224,197,85,23,56,157,247,26,96,182,69,47,9,237,38,111,36,219,163,227,22,19,196,24,80,9,130,92,70,235,108,69,123,51,78,3,19,170,229,104,136,197,20,64,203,68,96,191,143,61,182,225,94,36,56,209,230,9,130,3,148,237,184,154,220,6,52,235,118,144,242,157,228,248,46,114,124,55,57,190,251,28,95,41,199,247,156,227,171,77,123,212,152,22,189,53,61,30,157,206,67,116,28,113,32,131,222,244,120,12,250,220,200,253,16,32,53,27,205,53,110,50,213,137,212,25,52,202,192,180,98,152,243,148,152,66,36,48,179,200,204,217,130,175,195,1,13,249,83,23,246,90,12,55,118,170,134,5,215,56,218,140,18,32,120,31,135,146,133,0,239,136,177,157,93,235,242,202,80,31,234,198,231,118,202,189,159,18,29,231,136,206,115,68,215,41,209,93,142,232,49,37,122,170,38,250,247,118,198,107,180,235,95,116,149,18,203,26,92,75,222,172,98,220,28,214,146,94,116,29,233,232,245,84,43,12,164,10,35,233,101,58,81,125,94,103,228,142,244,24,60,166,76,22,199,148,182,163,131,255,97,220,138,22,67,130,16,52,200,92,196,73,179,168,9,47,124,210,116,92,151,35,45,80,80,32,97,89,12,27,149,199,147,208,231,209,101,139,46,0,136,29,209,211,184,97,109,203,97,200,74,155,47,242,113,178,189,148,235,40,199,117,150,227,186,74,185,10,41,215,67,142,171,146,227,122,77,185,222,191,251,15,167,54,248,198,183,6,0,0};
+#endif
 
-const uint8_t zxcppvbn::adjacency_graphs[] = {31,139,8,8,137,102,146,82,2,255,97,100,106,97,99,101,110,99,121,95,103,114,97,112,104,115,0,165,151,107,67,83,71,16,134,203,206,47,17,21,36,36,16,8,4,2,4,197,90,235,181,173,149,182,84,80,12,132,107,184,223,175,253,237,125,222,217,72,200,186,159,90,62,152,115,102,119,102,159,185,236,204,241,240,124,237,232,228,50,60,178,202,67,51,27,127,108,71,191,219,218,79,22,158,216,100,1,65,121,192,246,127,181,173,215,22,138,182,251,222,90,111,109,231,157,13,205,178,18,202,86,123,194,111,105,217,14,126,211,166,48,150,218,152,180,137,62,4,108,195,192,233,31,22,102,82,27,207,108,228,1,191,232,157,255,101,135,31,44,188,176,227,143,210,197,194,250,75,91,253,209,46,22,44,188,178,141,159,237,242,111,153,216,126,99,123,191,216,202,115,11,239,100,136,99,57,124,122,74,230,138,51,22,28,4,102,160,22,175,37,231,164,48,47,107,80,85,191,200,8,166,176,28,22,236,234,147,206,106,190,208,41,160,44,217,231,91,243,191,240,85,255,58,88,104,230,120,54,115,60,59,57,158,131,28,207,73,142,231,34,229,185,233,240,60,180,209,103,252,142,61,18,9,129,10,253,50,133,65,223,49,252,212,194,160,78,224,15,1,226,48,172,243,217,210,223,235,250,149,84,127,66,103,155,50,140,11,48,132,105,129,65,142,50,58,88,68,63,60,237,182,226,190,131,7,237,217,159,18,56,248,201,188,12,108,190,82,12,16,135,183,10,9,233,198,111,76,22,61,227,193,43,136,50,32,18,28,178,227,169,11,31,173,49,39,26,152,176,122,225,9,9,94,5,208,82,17,200,143,125,79,88,148,22,14,214,7,229,32,56,64,133,101,89,51,201,128,102,61,172,166,124,27,57,190,86,142,111,63,199,119,156,227,59,207,241,93,231,248,122,211,28,245,165,65,47,164,215,99,72,60,156,142,34,10,120,48,154,94,143,170,234,198,164,135,1,92,11,83,185,196,205,166,118,220,117,10,141,48,80,173,8,94,202,37,170,16,19,136,89,164,230,194,27,173,195,1,13,254,19,23,246,6,47,110,228,68,13,9,170,126,181,41,37,64,208,94,119,75,193,13,240,140,49,182,179,235,147,41,50,196,135,184,241,250,37,229,94,73,137,214,115,68,219,57,162,189,148,232,40,71,116,150,18,93,117,19,253,211,185,227,15,236,171,222,200,42,33,182,240,88,182,76,201,58,241,206,17,6,210,70,87,74,75,111,164,219,194,120,106,161,150,54,211,122,247,125,157,51,41,146,99,240,168,50,11,126,77,73,59,118,208,111,122,87,12,94,36,24,130,6,51,45,191,105,193,99,194,3,175,36,29,213,15,238,22,40,88,192,97,11,94,108,68,30,77,142,222,246,44,7,207,2,128,200,49,186,233,29,54,124,22,12,94,217,210,141,169,156,66,35,229,90,203,113,109,229,184,118,83,174,195,148,235,52,199,117,153,227,186,77,185,122,154,103,251,71,141,214,189,169,69,22,84,249,157,169,5,158,42,168,168,253,241,190,178,14,158,238,107,123,114,97,148,75,162,252,140,165,118,58,147,11,35,66,152,201,217,233,76,175,162,175,51,189,240,36,22,93,236,56,113,122,17,39,36,88,194,55,74,54,78,47,206,5,19,6,174,40,81,84,101,251,217,177,144,227,116,209,16,157,151,41,116,217,207,30,130,167,134,181,160,184,114,22,150,99,117,47,121,124,190,159,94,25,158,205,28,207,78,142,231,32,199,115,146,227,185,72,121,110,58,60,157,233,213,30,138,253,223,42,129,23,175,132,65,157,169,62,169,252,114,49,152,95,36,38,246,206,186,143,54,149,89,37,181,211,153,98,237,25,58,237,87,156,228,232,22,106,126,101,172,120,58,99,177,198,110,163,170,115,245,88,138,120,182,233,25,139,147,44,54,159,216,50,60,233,28,204,241,4,130,51,212,230,61,82,156,131,7,156,192,37,209,144,241,160,96,155,165,56,138,22,99,199,128,100,216,169,130,195,240,236,81,210,96,89,205,113,109,228,184,90,41,215,126,142,235,56,199,117,158,114,93,167,92,189,105,110,250,210,32,23,210,171,225,83,43,246,4,110,15,4,106,145,163,233,213,232,76,46,140,104,250,77,117,39,107,54,103,229,121,123,164,227,121,108,245,174,26,219,3,71,55,253,190,49,183,48,129,6,49,161,10,77,51,43,246,93,28,34,202,120,170,111,30,239,7,113,198,35,223,243,61,193,151,120,110,247,55,205,45,182,243,22,219,243,189,185,213,166,94,73,137,214,115,68,219,41,209,94,142,232,40,71,116,150,18,93,117,19,101,231,150,190,208,238,205,45,136,52,149,6,210,54,87,74,139,110,164,219,194,120,106,161,150,182,211,122,122,83,231,188,33,147,58,210,69,217,105,114,241,68,37,162,30,63,143,245,217,242,186,253,201,19,103,243,133,119,175,240,190,61,199,241,26,151,125,114,97,1,109,2,135,158,79,46,30,49,132,102,252,2,208,96,113,178,248,245,140,185,246,151,147,79,174,56,146,245,169,213,72,169,214,114,84,91,57,170,221,148,234,48,165,58,205,81,93,230,168,110,187,169,122,90,107,151,7,141,38,237,174,102,5,43,121,119,172,234,66,13,235,169,100,146,79,42,75,133,216,57,245,30,124,13,137,150,38,116,217,202,54,106,149,118,107,29,81,63,180,113,36,229,248,63,50,27,241,213,161,111,159,253,172,85,245,44,53,221,73,223,93,245,29,229,152,112,140,78,98,92,50,173,51,10,205,69,227,254,170,38,171,207,87,23,176,164,107,236,251,85,65,210,80,137,176,92,112,124,211,170,102,167,185,168,230,239,99,56,190,219,88,93,190,115,190,202,66,116,190,114,231,188,220,175,201,245,154,107,186,243,85,57,95,143,222,151,98,104,254,139,247,131,255,223,253,250,119,238,187,183,119,254,215,239,34,208,9,128,100,119,1,112,47,92,224,73,236,249,225,95,235,166,166,198,118,15,0,0};
+#if ZXCPPVBN_GRAPH_DVORAK
+static const uint8_t dvorak_graph[] = {31,139,8,0,0,0,0,0,2,3,109,148,103,91,83,65,16,133,117,206,47,161,247,222,65,138,138,74,81,108,168,40,69,74,128,144,64,66,13,161,249,219,125,103,190,240,100,159,205,135,60,247,206,157,57,251,206,153,221,45,212,170,151,123,101,107,213,72,139,164,177,54,157,127,81,255,156,172,83,147,221,4,6,187,116,249,77,7,111,101,189,234,104,214,240,130,231,241,189,250,89,123,175,101,131,154,234,36,107,243,65,167,31,61,209,70,83,157,73,77,180,19,32,13,145,227,15,178,87,57,157,5,13,53,145,69,172,55,190,219,162,78,150,117,244,222,43,138,75,218,127,163,250,134,108,73,133,69,143,160,116,189,174,179,79,30,183,88,23,76,24,6,230,117,245,93,149,53,89,172,61,218,234,28,119,191,117,243,67,135,239,100,235,46,69,45,249,228,220,254,114,5,219,80,121,213,215,66,25,53,201,182,52,219,163,248,217,174,255,7,152,21,114,60,197,28,207,105,142,231,60,199,115,157,227,169,167,60,143,207,60,45,238,155,92,7,53,140,178,142,192,35,200,11,54,202,122,124,205,237,39,105,235,81,234,251,43,27,240,193,128,66,12,25,34,0,217,72,170,51,161,241,29,2,76,156,110,232,210,102,228,122,12,231,226,171,47,60,159,83,137,113,82,194,104,233,224,58,220,181,40,103,226,196,233,172,24,19,179,85,149,86,188,105,218,194,54,244,98,232,44,204,242,24,193,26,51,211,178,112,138,117,232,128,21,238,255,168,246,83,22,166,160,205,39,94,41,221,116,111,229,36,3,65,101,1,195,115,184,68,149,29,228,184,142,115,92,229,148,171,154,227,186,202,113,221,166,92,15,41,87,115,58,155,246,212,228,238,244,104,244,123,46,103,128,193,112,122,32,96,0,54,156,30,141,113,223,69,242,90,68,216,77,54,221,56,172,185,156,74,108,88,122,166,115,192,201,138,82,128,144,97,233,66,156,55,91,113,9,42,240,132,93,72,214,154,247,136,139,52,132,203,116,202,46,181,184,15,160,166,97,226,149,200,177,248,196,51,105,88,68,105,248,196,27,158,249,235,78,74,189,159,18,29,229,136,74,41,81,37,71,116,153,35,170,165,68,247,141,68,255,158,79,119,147,118,253,141,97,97,176,172,205,189,147,179,64,132,135,214,149,94,115,125,233,166,27,106,84,24,75,21,166,210,235,116,54,61,169,108,17,74,25,29,227,98,219,201,98,112,236,68,202,233,190,20,179,177,101,127,70,19,19,113,168,30,183,151,197,197,131,143,116,77,203,148,198,198,165,26,227,168,35,16,23,14,66,84,226,106,57,14,164,5,25,83,129,18,185,147,144,182,109,239,146,223,108,92,37,182,151,82,29,230,168,78,114,84,103,41,213,69,74,117,147,163,186,203,81,61,53,82,189,124,241,31,104,150,75,145,183,6,0,0};
+#endif
+
+#if ZXCPPVBN_GRAPH_KEYPAD
+static const uint8_t keypad_graph[] = {31,139,8,0,0,0,0,0,2,3,37,143,65,18,195,32,12,3,91,233,55,97,8,73,128,16,158,211,153,246,212,75,175,253,125,37,215,7,99,173,108,48,239,215,247,243,120,34,113,114,97,166,227,36,22,22,87,153,230,23,145,101,70,88,35,60,17,91,131,88,185,241,96,253,55,96,87,106,236,34,155,165,210,30,238,26,110,85,221,245,130,194,99,56,228,182,32,53,0,209,165,135,46,158,193,236,163,169,219,168,135,36,134,199,75,0,89,56,117,186,63,137,122,2,222,171,196,119,146,127,211,9,239,25,104,134,110,196,253,246,3,12,240,8,84,250,0,0,0};
+#endif
+
+#if ZXCPPVBN_GRAPH_MAC_KEYPAD
+static const uint8_t mac_keypad_graph[] = {31,139,8,0,0,0,0,0,2,3,29,143,205,14,194,48,12,131,193,126,155,78,251,109,187,173,135,61,203,52,1,39,132,196,149,183,199,113,14,105,252,57,137,210,207,245,56,223,175,223,247,122,162,227,202,198,158,17,153,72,28,93,138,52,34,210,200,20,58,250,48,242,136,58,217,221,137,129,19,23,141,57,48,43,21,86,145,41,164,210,108,119,176,155,85,87,45,233,36,98,14,139,236,98,148,13,136,42,189,105,111,51,11,31,69,221,129,170,37,177,197,174,195,64,22,86,189,187,239,239,232,17,196,93,135,143,238,125,115,37,118,109,48,107,214,133,240,47,12,194,195,253,246,7,206,249,204,218,17,1,0,0};
+#endif
+
+const zxcppvbn::database zxcppvbn::adjacency_graphs[] = {
+#if ZXCPPVBN_GRAPH_QWERTY
+	{ "qwerty", qwerty_graph, sizeof(qwerty_graph) },
+#endif
+#if ZXCPPVBN_GRAPH_DVORAK
+	{ "dvorak", dvorak_graph, sizeof(dvorak_graph) },
+#endif
+#if ZXCPPVBN_GRAPH_KEYPAD
+	{ "keypad", keypad_graph, sizeof(keypad_graph) },
+#endif
+#if ZXCPPVBN_GRAPH_MAC_KEYPAD
+	{ "mac_keypad", mac_keypad_graph, sizeof(mac_keypad_graph) },
+#endif
+	{ nullptr, nullptr, 0 }
+};
+
+// Statistics of all the graphs, including the ones left out of the build, in name order
+const zxcppvbn::graph_statistics zxcppvbn::adjacency_graph_statistics[] = {
+	{ "dvorak", 9.191489361702128, 94 },
+	{ "keypad", 5.066666666666666, 15 },
+	{ "mac_keypad", 5.25, 16 },
+	{ "qwerty", 9.191489361702128, 94 },
+	{ nullptr, 0, 0 }
+};
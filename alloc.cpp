@@ -0,0 +1,158 @@
+#include "zxcppvbn.hpp"
+
+// Allocation accounting: when the library is built with ZXCPPVBN_ALLOC_ACCOUNTING, the global operator new and delete are replaced
+// by counting ones, for the whole program (this is an instrumentation build, for benchmarks), and operator() and k_best report
+// the allocations of their evaluations in result::allocations and result::phase_allocations (estimate only returns a verdict,
+// it is not measured)
+#ifdef ZXCPPVBN_ALLOC_ACCOUNTING
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+//////////////////////////////////////////////////////////////////////////
+// Counting allocator
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	// Counters of the calling thread (memory freed by another thread than the one which allocated it makes live_bytes drift,
+	// which is why only differences are reported, and why the tasks of parallel evaluations hand over their results)
+	struct allocation_counters {
+		uint64_t allocations;
+		uint64_t bytes;
+		int64_t live_bytes;
+		int64_t peak_bytes;
+	};
+	thread_local allocation_counters counters = { 0, 0, 0, 0 };
+
+	// Each block starts with its size, the header keeps the alignment of malloc
+	const size_t header_size = 16;
+
+	void* counted_alloc(size_t size)
+	{
+		void* block = ::malloc(header_size + size);
+		if (!block) {
+			return nullptr;
+		}
+		*static_cast<size_t*>(block) = size;
+		counters.allocations++;
+		counters.bytes += size;
+		counters.live_bytes += size;
+		if (counters.live_bytes > counters.peak_bytes) {
+			counters.peak_bytes = counters.live_bytes;
+		}
+		return static_cast<char*>(block) + header_size;
+	}
+
+	void counted_free(void* ptr)
+	{
+		if (ptr) {
+			void* block = static_cast<char*>(ptr) - header_size;
+			counters.live_bytes -= *static_cast<size_t*>(block);
+			::free(block);
+		}
+	}
+
+	void* counted_new(size_t size)
+	{
+		for (;;) {
+			void* ptr = counted_alloc(size);
+			if (ptr) {
+				return ptr;
+			}
+			std::new_handler handler = std::get_new_handler();
+			if (!handler) {
+				throw std::bad_alloc();
+			}
+			handler();
+		}
+	}
+}
+
+void* operator new(size_t size)
+{
+	return counted_new(size);
+}
+
+void* operator new[](size_t size)
+{
+	return counted_new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	return counted_alloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+	return counted_alloc(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	counted_free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	counted_free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+	counted_free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+	counted_free(ptr);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Allocation scopes
+//////////////////////////////////////////////////////////////////////////
+
+// Start counting, the peak restarts from the current live memory
+zxcppvbn::allocation_scope zxcppvbn::begin_allocations()
+{
+	allocation_scope scope = { counters.allocations, counters.bytes, counters.live_bytes, counters.peak_bytes };
+	counters.peak_bytes = counters.live_bytes;
+	return scope;
+}
+
+// Allocations since the beginning of the scope, the peak of the enclosing scope is restored
+zxcppvbn::allocation_stats zxcppvbn::end_allocations(const allocation_scope& scope)
+{
+	allocation_stats stats;
+	stats.allocations = counters.allocations - scope.allocations;
+	stats.bytes = counters.bytes - scope.bytes;
+	stats.peak_bytes = (uint64_t)(counters.peak_bytes - scope.live_bytes);
+	if (scope.saved_peak_bytes > counters.peak_bytes) {
+		counters.peak_bytes = scope.saved_peak_bytes;
+	}
+	return stats;
+}
+
+// End the scope of a task run on a worker thread for an evaluation, the memory it leaves live (its results) is handed over to
+// the evaluating thread, which frees it
+zxcppvbn::allocation_stats zxcppvbn::end_task_allocations(const allocation_scope& scope, int64_t& live_bytes)
+{
+	allocation_stats stats = end_allocations(scope);
+	live_bytes = counters.live_bytes - scope.live_bytes;
+	counters.live_bytes = scope.live_bytes;
+	return stats;
+}
+
+// Count the allocations of a task as ones of the evaluating thread when its results are collected (the tasks ran concurrently,
+// so the peak is only estimated, as the peak of the task on top of the live memory of the evaluation)
+void zxcppvbn::add_task_allocations(const allocation_stats& stats, int64_t live_bytes)
+{
+	counters.allocations += stats.allocations;
+	counters.bytes += stats.bytes;
+	counters.peak_bytes = std::max(counters.peak_bytes, counters.live_bytes + (int64_t)stats.peak_bytes);
+	counters.live_bytes += live_bytes;
+}
+
+#endif
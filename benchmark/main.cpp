@@ -0,0 +1,130 @@
+#include "../zxcppvbn.hpp"
+#include "workloads.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+// Throughput benchmark over the fixed workloads of workloads.hpp
+//
+// usage: benchmark [--data dir] [--count n] [--repeat n] [--filter workload] [--no-common-verdicts] [--no-explain] [--trace file]
+// (--trace writes the last events of the run as Chrome trace JSON)
+// (run from the repository root, or give the data directory)
+
+struct settings {
+	std::string data;
+	size_t count;
+	size_t repeat;
+	std::string filter;
+	bool common_verdicts;
+	bool explain;
+	std::string trace;
+};
+
+double percentile(const std::vector<uint64_t>& sorted, double p)
+{
+	if (sorted.empty()) {
+		return 0.0;
+	}
+	size_t index = std::min(sorted.size() - 1, (size_t)(p * sorted.size()));
+	return (double)sorted[index];
+}
+
+void run_workload(zxcppvbn& zxcvbn, const workload& load, size_t repeat)
+{
+	// Warm up (first touches of the dictionaries and tables)
+	for (size_t n = 0; n < load.passwords.size() && n < 100; n++) {
+		zxcvbn(load.passwords[n]);
+	}
+
+	std::vector<uint64_t> latencies;
+	latencies.reserve(load.passwords.size() * repeat);
+	uint64_t total = 0;
+	size_t chars = 0;
+	double checksum = 0.0;
+	zxcppvbn::allocation_stats allocations = zxcppvbn::allocation_stats();
+	for (size_t r = 0; r < repeat; r++) {
+		for (auto& password : load.passwords) {
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			zxcppvbn::result result = zxcvbn(password);
+			uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+			checksum += result.entropy;
+			allocations.allocations += result.allocations.allocations;
+			allocations.bytes += result.allocations.bytes;
+			allocations.peak_bytes = std::max(allocations.peak_bytes, result.allocations.peak_bytes);
+			latencies.push_back(elapsed);
+			total += elapsed;
+			chars += password.size();
+		}
+	}
+	std::sort(latencies.begin(), latencies.end());
+
+	double evaluations = (double)latencies.size();
+	printf("%-20s %8zu %12.0f %10.1f %10.0f %10.0f %10.0f %14.3f", load.name.c_str(), latencies.size(),
+		total ? evaluations * 1e9 / total : 0.0, chars ? (double)total / chars : 0.0,
+		percentile(latencies, 0.50), percentile(latencies, 0.99), percentile(latencies, 0.999), checksum / (evaluations ? evaluations : 1.0));
+#ifdef ZXCPPVBN_ALLOC_ACCOUNTING
+	printf(" %12.1f %12.0f %12llu", allocations.allocations / evaluations, allocations.bytes / evaluations, (unsigned long long)allocations.peak_bytes);
+#endif
+	printf("\n");
+}
+
+int main(int argc, char** argv)
+{
+	settings config{ "data", 2000, 3, "", true, true, "" };
+	for (int a = 1; a < argc; a++) {
+		if (!strcmp(argv[a], "--data") && a + 1 < argc) {
+			config.data = argv[++a];
+		} else if (!strcmp(argv[a], "--count") && a + 1 < argc) {
+			config.count = std::stoul(argv[++a]);
+		} else if (!strcmp(argv[a], "--repeat") && a + 1 < argc) {
+			config.repeat = std::stoul(argv[++a]);
+		} else if (!strcmp(argv[a], "--filter") && a + 1 < argc) {
+			config.filter = argv[++a];
+		} else if (!strcmp(argv[a], "--no-common-verdicts")) {
+			config.common_verdicts = false;
+		} else if (!strcmp(argv[a], "--no-explain")) {
+			config.explain = false;
+		} else if (!strcmp(argv[a], "--trace") && a + 1 < argc) {
+			config.trace = argv[++a];
+		} else {
+			std::cerr << "usage: benchmark [--data dir] [--count n] [--repeat n] [--filter workload] [--no-common-verdicts] [--no-explain] [--trace file]" << std::endl;
+			return 1;
+		}
+	}
+
+	std::vector<workload> workloads = build_workloads(config.data, config.count);
+	if (workloads[0].passwords.empty()) {
+		std::cerr << "cannot read " << config.data << "/common_passwords.txt" << std::endl;
+		return 1;
+	}
+
+	zxcppvbn::options opts;
+	opts.common_verdicts = config.common_verdicts;
+	opts.explain = config.explain;
+	zxcppvbn zxcvbn(opts);
+
+	// The mean entropy is printed to check that runs being compared computed the same thing
+	printf("%-20s %8s %12s %10s %10s %10s %10s %14s", "workload", "evals", "evals/s", "ns/char", "p50 ns", "p99 ns", "p999 ns", "mean entropy");
+#ifdef ZXCPPVBN_ALLOC_ACCOUNTING
+	// Allocations and bytes per evaluation, highest peak of live memory of an evaluation
+	printf(" %12s %12s %12s", "allocs/eval", "bytes/eval", "peak bytes");
+#endif
+	printf("\n");
+	if (!config.trace.empty()) {
+		zxcppvbn::start_tracing();
+	}
+	for (auto& load : workloads) {
+		if (config.filter.empty() || load.name.find(config.filter) != std::string::npos) {
+			run_workload(zxcvbn, load, config.repeat);
+		}
+	}
+	if (!config.trace.empty()) {
+		zxcppvbn::stop_tracing();
+		std::ofstream out(config.trace);
+		zxcppvbn::write_trace(out);
+	}
+}
@@ -0,0 +1,225 @@
+#include "../zxcppvbn.hpp"
+#include "workloads.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+// Per-stage microbenchmark: times the prescan, each matcher of the pipeline, the match ordering, the pruning (with the entropies it
+// compares), the entropy functions on the matches left and the scoring DP, in the order of an evaluation, on the workloads of
+// workloads.hpp, and attributes the total evaluation time to them
+//
+// usage: matchers [--data dir] [--count n] [--repeat n] [--filter workload] [--reference]
+// (run from the repository root, or give the data directory)
+
+struct matcher_profiler
+{
+	struct stage {
+		std::string name;
+		uint64_t calls;
+		uint64_t nanoseconds;
+		uint64_t matches;
+		zxcppvbn::allocation_stats allocations;     // with ZXCPPVBN_ALLOC_ACCOUNTING, the peak is the highest of a call
+	};
+
+	const zxcppvbn& estimator;
+	std::vector<stage> stages;
+
+	// The stages are listed in the order of an evaluation
+	matcher_profiler(const zxcppvbn& estimator)
+		: estimator(estimator), stages()
+	{
+		find_stage("prescan");
+		add_matchers(zxcppvbn::matchers());
+		find_stage("sort");
+		find_stage("prune_matches");
+		for (size_t p = 0; p < (size_t)zxcppvbn::pattern::BRUTEFORCE; p++) {
+			find_stage(std::string(pattern_name((zxcppvbn::pattern)p)) + " entropy");
+		}
+		find_stage("minimum_entropy_match_sequence");
+	}
+
+	template <zxcppvbn::pattern P, zxcppvbn::matcher_func M, uint8_t required_classes, typename... Stages>
+	void add_matchers(zxcppvbn::matcher_list<zxcppvbn::matcher_stage<P, M, required_classes>, Stages...>)
+	{
+		find_stage(zxcppvbn::matcher_name(M));
+		add_matchers(zxcppvbn::matcher_list<Stages...>());
+	}
+
+	void add_matchers(zxcppvbn::matcher_list<>)
+	{
+	}
+
+	stage& find_stage(const std::string& name)
+	{
+		for (auto& stage : stages) {
+			if (stage.name == name) {
+				return stage;
+			}
+		}
+		stages.push_back(stage{ name, 0, 0, 0, zxcppvbn::allocation_stats() });
+		return stages.back();
+	}
+
+	template <typename F> void time(const std::string& name, F function)
+	{
+#ifdef ZXCPPVBN_ALLOC_ACCOUNTING
+		zxcppvbn::allocation_scope scope = zxcppvbn::begin_allocations();
+#endif
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		function();
+		uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+#ifdef ZXCPPVBN_ALLOC_ACCOUNTING
+		zxcppvbn::allocation_stats allocations = zxcppvbn::end_allocations(scope);
+#endif
+		stage& stage = find_stage(name);
+		stage.nanoseconds += elapsed;
+		stage.calls++;
+#ifdef ZXCPPVBN_ALLOC_ACCOUNTING
+		stage.allocations.allocations += allocations.allocations;
+		stage.allocations.bytes += allocations.bytes;
+		stage.allocations.peak_bytes = std::max(stage.allocations.peak_bytes, allocations.peak_bytes);
+#endif
+	}
+
+	static const char* pattern_name(zxcppvbn::pattern pattern)
+	{
+		switch (pattern) {
+		case zxcppvbn::pattern::DICTIONARY: return "dictionary";
+		case zxcppvbn::pattern::L33T: return "l33t";
+		case zxcppvbn::pattern::SPATIAL: return "spatial";
+		case zxcppvbn::pattern::REPEAT: return "repeat";
+		case zxcppvbn::pattern::SEQUENCE: return "sequence";
+		case zxcppvbn::pattern::DIGITS: return "digits";
+		case zxcppvbn::pattern::YEAR: return "year";
+		case zxcppvbn::pattern::DATE: return "date";
+		case zxcppvbn::pattern::BRUTEFORCE: return "bruteforce";
+		}
+		return "";
+	}
+
+	// Run the stages of the pipeline one by one, skipping them as omnimatch does
+	template <zxcppvbn::pattern P, zxcppvbn::matcher_func M, uint8_t required_classes, typename... Stages>
+	void run_matchers(zxcppvbn::matcher_list<zxcppvbn::matcher_stage<P, M, required_classes>, Stages...>, const std::string& password, uint8_t classes, std::vector<std::unique_ptr<zxcppvbn::match>>& results)
+	{
+		if ((classes & required_classes) == required_classes) {
+			std::vector<std::unique_ptr<zxcppvbn::match>> matches;
+			std::string name = zxcppvbn::matcher_name(M);
+			time(name, [&]() { matches = (estimator.*M)(password, classes); });
+			find_stage(name).matches += matches.size();
+			std::move(matches.begin(), matches.end(), std::back_inserter(results));
+		}
+		run_matchers(zxcppvbn::matcher_list<Stages...>(), password, classes, results);
+	}
+
+	void run_matchers(zxcppvbn::matcher_list<>, const std::string&, uint8_t, std::vector<std::unique_ptr<zxcppvbn::match>>&)
+	{
+	}
+
+	// The steps of operator() (without the user inputs and the precomputed verdicts), each one timed separately
+	void profile(const std::string& password)
+	{
+		uint8_t classes = 0;
+		time("prescan", [&]() { classes = estimator.prescan(password); });
+
+		std::vector<std::unique_ptr<zxcppvbn::match>> matches;
+		run_matchers(zxcppvbn::matchers(), password, classes, matches);
+
+		std::vector<size_t> ends;
+		time("sort", [&]() {
+			std::sort(matches.begin(), matches.end(), [](const std::unique_ptr<zxcppvbn::match>& match1, const std::unique_ptr<zxcppvbn::match>& match2) {
+				return (match1->i < match2->i) || ((match1->i == match2->i) && (match1->j < match2->j));
+			});
+			ends = zxcppvbn::bucket_matches(matches, password.size(), &zxcppvbn::match::j);
+		});
+
+		time("prune_matches", [&]() { estimator.prune_matches(matches, ends, 1); });
+
+		// the entropies of matches sharing their span are calculated by the pruning, the others when the DP visits them (the
+		// entropy is only calculated once)
+		for (auto& match : matches) {
+			time(std::string(pattern_name(match->pattern)) + " entropy", [&]() { estimator.calc_entropy(*match); });
+		}
+
+		zxcppvbn::result result;
+		zxcppvbn::phase_timer timer(nullptr);
+		time("minimum_entropy_match_sequence", [&]() { result = estimator.minimum_entropy_match_sequence(password, matches, ends, timer); });
+	}
+
+	void report(const std::string& workload)
+	{
+		uint64_t total = 0;
+		for (auto& stage : stages) {
+			total += stage.nanoseconds;
+		}
+		printf("%s (total %.3f ms)\n", workload.c_str(), total / 1e6);
+		printf("  %-32s %10s %10s %12s %8s %10s", "stage", "calls", "matches", "total ms", "share", "ns/call");
+#ifdef ZXCPPVBN_ALLOC_ACCOUNTING
+		printf(" %12s %12s %12s", "allocs/call", "bytes/call", "peak bytes");
+#endif
+		printf("\n");
+		for (auto& stage : stages) {
+			if (stage.calls == 0) {
+				continue;
+			}
+			printf("  %-32s %10llu %10llu %12.3f %7.1f%% %10.0f", stage.name.c_str(), (unsigned long long)stage.calls, (unsigned long long)stage.matches,
+				stage.nanoseconds / 1e6, total ? 100.0 * stage.nanoseconds / total : 0.0, stage.calls ? (double)stage.nanoseconds / stage.calls : 0.0);
+#ifdef ZXCPPVBN_ALLOC_ACCOUNTING
+			printf(" %12.1f %12.0f %12llu", stage.calls ? (double)stage.allocations.allocations / stage.calls : 0.0,
+				stage.calls ? (double)stage.allocations.bytes / stage.calls : 0.0, (unsigned long long)stage.allocations.peak_bytes);
+#endif
+			printf("\n");
+		}
+		printf("\n");
+	}
+};
+
+int main(int argc, char** argv)
+{
+	std::string data = "data";
+	size_t count = 500;
+	size_t repeat = 1;
+	std::string filter;
+	zxcppvbn::options opts;
+	for (int a = 1; a < argc; a++) {
+		if (!strcmp(argv[a], "--data") && a + 1 < argc) {
+			data = argv[++a];
+		} else if (!strcmp(argv[a], "--count") && a + 1 < argc) {
+			count = std::stoul(argv[++a]);
+		} else if (!strcmp(argv[a], "--repeat") && a + 1 < argc) {
+			repeat = std::stoul(argv[++a]);
+		} else if (!strcmp(argv[a], "--filter") && a + 1 < argc) {
+			filter = argv[++a];
+		} else if (!strcmp(argv[a], "--reference")) {
+			// Profile the std::regex based digits, year and date matchers instead
+			opts.reference_digits = true;
+			opts.reference_date_sep = true;
+			opts.reference_date_without_sep = true;
+		} else {
+			std::cerr << "usage: matchers [--data dir] [--count n] [--repeat n] [--filter workload] [--reference]" << std::endl;
+			return 1;
+		}
+	}
+
+	std::vector<workload> workloads = build_workloads(data, count);
+	if (workloads[0].passwords.empty()) {
+		std::cerr << "cannot read " << data << "/common_passwords.txt" << std::endl;
+		return 1;
+	}
+
+	zxcppvbn zxcvbn(opts);
+	for (auto& load : workloads) {
+		if (!filter.empty() && load.name.find(filter) == std::string::npos) {
+			continue;
+		}
+		matcher_profiler profiler(zxcvbn);
+		for (size_t r = 0; r < repeat; r++) {
+			for (auto& password : load.passwords) {
+				profiler.profile(password);
+			}
+		}
+		profiler.report(load.name);
+	}
+}
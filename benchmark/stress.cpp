@@ -0,0 +1,202 @@
+#include "../zxcppvbn.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+// Adversarial latency stress: generates families of pathological passwords of doubling lengths, records the median, p999 and
+// worst latency of each length, and flags the families whose latency grows faster than linearly with the length (the growth
+// exponent of the median over the last three doublings, 1 is linear and 2 quadratic, is compared to the threshold: the small
+// lengths are dominated by fixed costs and the tails of a few samples are too noisy to flag on). The p999 is only shown with at
+// least 1000 latencies per length (samples x repeat), below that it would just be the worst one again.
+//
+// usage: stress [--max-length n] [--samples n] [--repeat n] [--threshold exponent] [--filter family] [--hardened]
+// Exits with 2 when a family is flagged.
+
+struct family {
+	const char* name;
+	std::string (*generate)(std::mt19937& rng, size_t length);
+};
+
+// Runs of the ambiguous l33t symbols (l33t_match enumerates their substitutions)
+std::string l33t_symbols(std::mt19937& rng, size_t length)
+{
+	static const std::string symbols = "1|7!";
+	std::string password;
+	while (password.size() < length) {
+		password += symbols[rng() % symbols.size()];
+	}
+	return password;
+}
+
+// Digit strings (digits, year and date matchers)
+std::string digits(std::mt19937& rng, size_t length)
+{
+	std::string password;
+	while (password.size() < length) {
+		password += (char)('0' + rng() % 10);
+	}
+	return password;
+}
+
+// Dates run together with their separators, and digits between them (date_sep_match)
+std::string separated_dates(std::mt19937& rng, size_t length)
+{
+	static const std::string separators = "/-._ ";
+	std::string password;
+	while (password.size() < length) {
+		char separator = separators[rng() % separators.size()];
+		password += std::to_string(1 + rng() % 12) + separator + std::to_string(1 + rng() % 31) + separator + std::to_string(1950 + rng() % 70);
+		password += std::to_string(rng() % 100);
+	}
+	return password.substr(0, length);
+}
+
+// Random walks on the qwerty keyboard, mostly along the rows (spatial_match)
+std::string keyboard_walk(std::mt19937& rng, size_t length)
+{
+	static const char* rows[] = { "1234567890-=", "qwertyuiop[]", "asdfghjkl;'", "zxcvbnm,./" };
+	size_t row = rng() % 4, column = rng() % 10;
+	int direction = 1;
+	std::string password;
+	while (password.size() < length) {
+		password += rows[row][column];
+		switch (rng() % 8) {
+		case 0:
+			row = (row + 1) % 4;
+			break;
+		case 1:
+			row = (row + 3) % 4;
+			break;
+		case 2:
+			direction = -direction;
+			break;
+		default:
+			break;
+		}
+		size_t width = strlen(rows[row]);
+		column = std::min(column, width - 1);
+		if ((direction < 0 && column == 0) || (direction > 0 && column == width - 1)) {
+			direction = -direction;
+		}
+		column += direction;
+	}
+	return password;
+}
+
+// Concatenations of common dictionary words (dictionary_match, and the overlapping matches of the scoring)
+std::string dictionary_words(std::mt19937& rng, size_t length)
+{
+	static const char* words[] = {
+		"password", "dragon", "monkey", "master", "letmein", "shadow", "sunshine", "princess", "football", "baseball",
+		"welcome", "superman", "trustno", "michael", "jennifer", "hunter", "thomas", "freedom", "summer", "computer"
+	};
+	std::string password;
+	while (password.size() < length) {
+		password += words[rng() % (sizeof(words) / sizeof(words[0]))];
+	}
+	return password.substr(0, length);
+}
+
+// One repeated character (repeat_match)
+std::string repeated(std::mt19937& rng, size_t length)
+{
+	return std::string(length, (char)('a' + rng() % 26));
+}
+
+double percentile(const std::vector<uint64_t>& sorted, double p)
+{
+	size_t index = std::min(sorted.size() - 1, (size_t)(p * sorted.size()));
+	return (double)sorted[index];
+}
+
+int main(int argc, char** argv)
+{
+	size_t max_length = 1024;
+	size_t samples = 20;
+	size_t repeat = 5;
+	double threshold = 1.5;
+	std::string filter;
+	zxcppvbn::options opts;
+	for (int a = 1; a < argc; a++) {
+		if (!strcmp(argv[a], "--max-length") && a + 1 < argc) {
+			max_length = std::stoul(argv[++a]);
+		} else if (!strcmp(argv[a], "--samples") && a + 1 < argc) {
+			samples = std::max<size_t>(1, std::stoul(argv[++a]));
+		} else if (!strcmp(argv[a], "--repeat") && a + 1 < argc) {
+			repeat = std::max<size_t>(1, std::stoul(argv[++a]));
+		} else if (!strcmp(argv[a], "--threshold") && a + 1 < argc) {
+			threshold = std::stod(argv[++a]);
+		} else if (!strcmp(argv[a], "--filter") && a + 1 < argc) {
+			filter = argv[++a];
+		} else if (!strcmp(argv[a], "--hardened")) {
+			opts.hardened = true;
+		} else {
+			std::cerr << "usage: stress [--max-length n] [--samples n] [--repeat n] [--threshold exponent] [--filter family] [--hardened]" << std::endl;
+			return 1;
+		}
+	}
+
+	static const family families[] = {
+		{ "l33t_symbols", l33t_symbols },
+		{ "digits", digits },
+		{ "separated_dates", separated_dates },
+		{ "keyboard_walk", keyboard_walk },
+		{ "dictionary_words", dictionary_words },
+		{ "repeated", repeated }
+	};
+
+	opts.common_verdicts = false;
+	opts.update_metrics = false;
+	zxcppvbn zxcvbn(opts);
+	bool flagged = false;
+	for (auto& fam : families) {
+		if (!filter.empty() && std::string(fam.name).find(filter) == std::string::npos) {
+			continue;
+		}
+		printf("%s\n", fam.name);
+		printf("  %8s %12s %12s %12s %10s\n", "length", "median ns", "p999 ns", "worst ns", "growth");
+		std::mt19937 rng(20140101);
+		std::vector<std::pair<size_t, double>> medians;
+		for (size_t length = 16; length <= max_length; length *= 2) {
+			std::vector<uint64_t> latencies;
+			for (size_t s = 0; s < samples; s++) {
+				std::string password = fam.generate(rng, length);
+				for (size_t r = 0; r < repeat; r++) {
+					std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+					zxcvbn(password);
+					latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+				}
+			}
+			std::sort(latencies.begin(), latencies.end());
+
+			// Growth exponent from the previous (half) length
+			double median = percentile(latencies, 0.5);
+			printf("  %8zu %12.0f", length, median);
+			if (latencies.size() >= 1000) {
+				printf(" %12.0f", percentile(latencies, 0.999));
+			} else {
+				printf(" %12s", "-");
+			}
+			printf(" %12llu", (unsigned long long)latencies.back());
+			if (!medians.empty()) {
+				printf(" %10.2f", std::log2(median / medians.back().second));
+			}
+			printf("\n");
+			medians.push_back(std::make_pair(length, median));
+		}
+		if (medians.size() > 1) {
+			size_t first = medians.size() > 4 ? medians.size() - 4 : 0;
+			double exponent = std::log2(medians.back().second / medians[first].second) / (medians.size() - 1 - first);
+			bool superlinear = exponent > threshold;
+			printf("  growth exponent from %zu to %zu: %.2f%s\n", medians[first].first, medians.back().first, exponent, superlinear ? "  SUPERLINEAR" : "");
+			flagged = flagged || superlinear;
+		}
+		printf("\n");
+	}
+	return flagged ? 2 : 0;
+}
@@ -0,0 +1,117 @@
+#ifndef ZXCPPVBN_BENCHMARK_WORKLOADS_HPP
+#define ZXCPPVBN_BENCHMARK_WORKLOADS_HPP
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Fixed benchmark workloads, drawn from the bundled corpora and from a seeded random generator (shared by the benchmarks)
+
+struct workload {
+	std::string name;
+	std::vector<std::string> passwords;
+};
+
+// First column of a text file (common passwords, census names)
+inline std::vector<std::string> read_column(const std::string& path, size_t count, bool lower)
+{
+	std::vector<std::string> words;
+	std::ifstream file(path);
+	std::string line;
+	while (words.size() < count && std::getline(file, line)) {
+		std::string word = line.substr(0, line.find_first_of(" \t\r"));
+		if (word.empty()) {
+			continue;
+		}
+		if (lower) {
+			std::transform(word.begin(), word.end(), word.begin(), ::tolower);
+		}
+		words.push_back(word);
+	}
+	return words;
+}
+
+// Words of the TV and movie frequency lists, in rank order
+inline std::vector<std::string> read_tv_words(const std::string& data, size_t count)
+{
+	static const char* pages[] = { "1-1000", "1001-2000", "2001-3000", "3001-4000", "4001-5000", "5001-6000", "6001-7000", "7001-8000", "8001-9000", "9001-10000" };
+	std::vector<std::string> words;
+	for (const char* page : pages) {
+		std::ifstream file(data + "/tv_and_movie_freqlist" + page + ".html");
+		std::string line;
+		while (words.size() < count && std::getline(file, line)) {
+			size_t start = line.find("<td><a ");
+			if (start == std::string::npos) {
+				continue;
+			}
+			start = line.find('>', start + 4);
+			size_t end = line.find("</a>", start);
+			if (start == std::string::npos || end == std::string::npos) {
+				continue;
+			}
+			// Only ASCII words, as in the frequency lists
+			std::string word = line.substr(start + 1, end - start - 1);
+			if (std::all_of(word.begin(), word.end(), [](char chr) { return chr > 0 && chr < 0x7f; })) {
+				words.push_back(word);
+			}
+		}
+	}
+	return words;
+}
+
+// Random passwords of a given length over a given alphabet
+inline std::vector<std::string> random_passwords(std::mt19937& rng, size_t count, size_t length, const std::string& alphabet)
+{
+	std::vector<std::string> passwords;
+	for (size_t n = 0; n < count; n++) {
+		std::string password;
+		for (size_t k = 0; k < length; k++) {
+			password += alphabet[rng() % alphabet.size()];
+		}
+		passwords.push_back(password);
+	}
+	return passwords;
+}
+
+inline std::vector<workload> build_workloads(const std::string& data, size_t count)
+{
+	std::vector<workload> workloads;
+	std::mt19937 rng(20140101);
+
+	workloads.push_back({ "common_passwords", read_column(data + "/common_passwords.txt", count, false) });
+
+	// Names followed by a two or four digit number, as people often do
+	std::vector<std::string> names = read_column(data + "/us_census_2000_surnames.txt", count / 2, true);
+	std::vector<std::string> first_names = read_column(data + "/us_census_2000_male_first.txt", count / 4, true);
+	std::vector<std::string> female_names = read_column(data + "/us_census_2000_female_first.txt", count / 4, true);
+	names.insert(names.end(), first_names.begin(), first_names.end());
+	names.insert(names.end(), female_names.begin(), female_names.end());
+	for (auto& name : names) {
+		name += std::to_string((rng() % 2) ? 1950 + rng() % 70 : rng() % 100);
+	}
+	workloads.push_back({ "census_names", names });
+
+	// Passphrases of three words
+	std::vector<std::string> words = read_tv_words(data, 10000);
+	std::vector<std::string> phrases;
+	for (size_t n = 0; n < count && !words.empty(); n++) {
+		phrases.push_back(words[rng() % words.size()] + words[rng() % words.size()] + words[rng() % words.size()]);
+	}
+	workloads.push_back({ "tv_passphrases", phrases });
+
+	const std::string lower = "abcdefghijklmnopqrstuvwxyz";
+	const std::string alphanumeric = lower + "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+	const std::string printable = alphanumeric + "!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~ ";
+	for (size_t length : { 8, 16, 32, 64 }) {
+		workloads.push_back({ "random_lower_" + std::to_string(length), random_passwords(rng, count, length, lower) });
+		workloads.push_back({ "random_alnum_" + std::to_string(length), random_passwords(rng, count, length, alphanumeric) });
+		workloads.push_back({ "random_print_" + std::to_string(length), random_passwords(rng, count, length, printable) });
+	}
+	workloads.push_back({ "random_digits_16", random_passwords(rng, count, 16, "0123456789") });
+	return workloads;
+}
+
+#endif
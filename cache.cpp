@@ -0,0 +1,217 @@
+#include "zxcppvbn.hpp"
+
+#include <algorithm>
+#include <random>
+
+//////////////////////////////////////////////////////////////////////////
+// Verdict cache
+//////////////////////////////////////////////////////////////////////////
+
+// The capacity is split evenly between the shards, the hash key is drawn at random so that keys are not comparable across processes
+zxcppvbn::cache::cache(size_t capacity, std::chrono::seconds ttl, size_t shards /* = 16 */)
+	: sip_key(), shard_capacity(), ttl(ttl), shards(), hit_count(0), miss_count(0)
+{
+	if (shards == 0) {
+		shards = 1;
+	}
+	shard_capacity = std::max<size_t>(1, (capacity + shards - 1) / shards);
+	for (size_t i = 0; i < shards; i++) {
+		this->shards.push_back(std::unique_ptr<shard>(new shard()));
+	}
+
+	std::random_device random;
+	for (uint64_t& half : sip_key) {
+		half = ((uint64_t)random() << 32) | random();
+	}
+}
+
+// Look up the verdict of a password, expired entries are dropped
+bool zxcppvbn::cache::find(const std::string& password, const std::vector<std::string>& user_inputs, const std::string& scope, verdict& result)
+{
+	uint64_t key = hash(password, user_inputs, scope);
+	shard& shard = shard_of(key);
+	{
+		std::lock_guard<std::mutex> guard(shard.lock);
+		auto it = shard.index.find(key);
+		if (it != shard.index.end()) {
+			if (it->second->expiry > std::chrono::steady_clock::now()) {
+				// Move to the front of the LRU list
+				shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+				result = it->second->result;
+				hit_count++;
+				return true;
+			}
+			shard.lru.erase(it->second);
+			shard.index.erase(it);
+		}
+	}
+	miss_count++;
+	return false;
+}
+
+void zxcppvbn::cache::insert(const std::string& password, const std::vector<std::string>& user_inputs, const std::string& scope, const verdict& result)
+{
+	insert(password, user_inputs, scope, result, ttl);
+}
+
+// Store the verdict of a password with its own time to live, evicting the least recently used entry of the shard when it is full
+void zxcppvbn::cache::insert(const std::string& password, const std::vector<std::string>& user_inputs, const std::string& scope, const verdict& result, std::chrono::seconds ttl)
+{
+	uint64_t key = hash(password, user_inputs, scope);
+	std::chrono::steady_clock::time_point expiry = std::chrono::steady_clock::now() + ttl;
+	shard& shard = shard_of(key);
+	std::lock_guard<std::mutex> guard(shard.lock);
+	auto it = shard.index.find(key);
+	if (it != shard.index.end()) {
+		it->second->result = result;
+		it->second->expiry = expiry;
+		shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+		return;
+	}
+	if (shard.lru.size() >= shard_capacity) {
+		shard.index.erase(shard.lru.back().key);
+		shard.lru.pop_back();
+	}
+	shard.lru.push_front(entry{ key, result, expiry });
+	shard.index[key] = shard.lru.begin();
+}
+
+void zxcppvbn::cache::clear()
+{
+	for (auto& shard : shards) {
+		std::lock_guard<std::mutex> guard(shard->lock);
+		shard->lru.clear();
+		shard->index.clear();
+	}
+}
+
+uint64_t zxcppvbn::cache::hits() const
+{
+	return hit_count;
+}
+
+uint64_t zxcppvbn::cache::misses() const
+{
+	return miss_count;
+}
+
+// Hash the password, the scope and the user inputs, each prefixed by its length so that different lists cannot give the same message
+uint64_t zxcppvbn::cache::hash(const std::string& password, const std::vector<std::string>& user_inputs, const std::string& scope) const
+{
+	// Sized once, a reallocation would free a copy of the plain text without wiping it
+	size_t size = 8 * (2 + user_inputs.size()) + password.size() + scope.size();
+	for (auto& input : user_inputs) {
+		size += input.size();
+	}
+	std::vector<uint8_t> message;
+	message.reserve(size);
+	auto append = [&message](const std::string& data) {
+		uint64_t size = data.size();
+		for (size_t i = 0; i < 8; i++) {
+			message.push_back((uint8_t)(size >> (8 * i)));
+		}
+		message.insert(message.end(), data.begin(), data.end());
+	};
+	append(password);
+	append(scope);
+	for (auto& input : user_inputs) {
+		append(input);
+	}
+
+	uint64_t key = siphash(sip_key, message.data(), message.size());
+	// Do not leave the plain text behind in freed memory (volatile stores, the compiler may not drop them as dead)
+	volatile uint8_t* bytes = message.data();
+	for (size_t i = 0; i < message.size(); i++) {
+		bytes[i] = 0;
+	}
+	return key;
+}
+
+// SipHash-2-4 (Aumasson and Bernstein)
+uint64_t zxcppvbn::cache::siphash(const uint64_t key[2], const uint8_t* data, size_t size)
+{
+	auto rotl = [](uint64_t x, int b) {
+		return (x << b) | (x >> (64 - b));
+	};
+
+	uint64_t v0 = 0x736f6d6570736575ULL ^ key[0];
+	uint64_t v1 = 0x646f72616e646f6dULL ^ key[1];
+	uint64_t v2 = 0x6c7967656e657261ULL ^ key[0];
+	uint64_t v3 = 0x7465646279746573ULL ^ key[1];
+	auto round = [&]() {
+		v0 += v1; v1 = rotl(v1, 13); v1 ^= v0; v0 = rotl(v0, 32);
+		v2 += v3; v3 = rotl(v3, 16); v3 ^= v2;
+		v0 += v3; v3 = rotl(v3, 21); v3 ^= v0;
+		v2 += v1; v1 = rotl(v1, 17); v1 ^= v2; v2 = rotl(v2, 32);
+	};
+	auto compress = [&](uint64_t m) {
+		v3 ^= m;
+		round();
+		round();
+		v0 ^= m;
+	};
+
+	// Little endian 8 byte words, the last one padded with zeros and the size in its top byte
+	size_t blocks = size / 8;
+	for (size_t b = 0; b < blocks; b++) {
+		uint64_t m = 0;
+		for (size_t i = 0; i < 8; i++) {
+			m |= (uint64_t)data[8 * b + i] << (8 * i);
+		}
+		compress(m);
+	}
+	uint64_t last = (uint64_t)size << 56;
+	for (size_t i = 0; i < size % 8; i++) {
+		last |= (uint64_t)data[8 * blocks + i] << (8 * i);
+	}
+	compress(last);
+
+	v2 ^= 0xff;
+	round();
+	round();
+	round();
+	round();
+	return v0 ^ v1 ^ v2 ^ v3;
+}
+
+zxcppvbn::cache::shard& zxcppvbn::cache::shard_of(uint64_t key)
+{
+	// The low bits index the shard maps, use the high ones to pick the shard
+	return *shards[(key >> 32) % shards.size()];
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Cached estimation
+//////////////////////////////////////////////////////////////////////////
+
+zxcppvbn::verdict zxcppvbn::estimate(const std::string& password, const std::vector<std::string>& user_inputs /* = std::vector<std::string>() */)
+{
+	// every call is counted as an evaluation, as in operator()
+	count_metric(METRIC_EVALUATIONS);
+	verdict result;
+	const common_verdict* common = find_common_verdict(password, user_inputs);
+	if (common) {
+		result.entropy = common->entropy;
+		result.crack_time = std::chrono::seconds(common->crack_time);
+		result.score = common->score;
+		count_metric(METRIC_COMMON_VERDICT_HITS);
+		return result;
+	}
+	if (opts.verdict_cache && opts.verdict_cache->find(password, user_inputs, cache_scope, result)) {
+		count_metric(METRIC_CACHE_HITS);
+		return result;
+	}
+
+	phase_timer timer(nullptr);
+	std::vector<size_t> ends;
+	std::vector<std::unique_ptr<match>> matches = find_matches(password, user_inputs, 1, ends, timer);
+	zxcppvbn::result res = minimum_entropy_match_sequence(password, matches, ends, timer);
+	result.entropy = res.entropy;
+	result.crack_time = res.crack_time;
+	result.score = res.score;
+
+	if (opts.verdict_cache) {
+		opts.verdict_cache->insert(password, user_inputs, cache_scope, result);
+	}
+	return result;
+}
@@ -0,0 +1,44 @@
+#include "../zxcppvbn.hpp"
+
+#include <cstring>
+#include <iostream>
+
+// Command line estimator: prints the score, entropy and crack time of each password given as argument, or of each line of the
+// standard input when there is none
+//
+// usage: zxcppvbn-cli [--input word]... [password...]
+
+int main(int argc, char** argv)
+{
+	std::vector<std::string> user_inputs;
+	std::vector<std::string> passwords;
+	for (int a = 1; a < argc; a++) {
+		if (!strcmp(argv[a], "--input") && a + 1 < argc) {
+			user_inputs.push_back(argv[++a]);
+		} else if (!strcmp(argv[a], "--help")) {
+			std::cerr << "usage: zxcppvbn-cli [--input word]... [password...]" << std::endl;
+			return 1;
+		} else {
+			passwords.push_back(argv[a]);
+		}
+	}
+
+	zxcppvbn zxcvbn;
+	auto print = [&](const std::string& password) {
+		zxcppvbn::result result = zxcvbn(password, user_inputs);
+		std::cout << result.score << '\t' << result.entropy << '\t' << result.crack_time_display << '\t' << password << std::endl;
+	};
+	if (passwords.empty()) {
+		std::string line;
+		while (std::getline(std::cin, line)) {
+			if (!line.empty() && line.back() == '\r') {
+				line.pop_back();
+			}
+			print(line);
+		}
+	} else {
+		for (auto& password : passwords) {
+			print(password);
+		}
+	}
+}
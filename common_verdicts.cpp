@@ -0,0 +1,1034 @@
+#include "zxcppvbn.hpp"
+
+// Generated by scripts/build_common_verdicts.cpp, do not edit
+
+// Only used by the full profile
+#if ZXCPPVBN_FULL_PROFILE
+
+const size_t zxcppvbn::common_verdicts_size = 1000;
+
+const zxcppvbn::common_verdict zxcppvbn::common_verdicts[] = {
+	{ "anthony", "male_names", 22, 4.4594316186372973, 0, 4.4594316186372973, 0, 0 },
+	{ "lauren", "female_names", 162, 7.3398500028846243, 0, 7.3398500028846243, 0, 0 },
+	{ "runner", "passwords", 305, 8.2526654324502484, 0, 8.2526654324502484, 0, 0 },
+	{ "openup", "passwords", 794, 9.6329951971429573, 0, 9.6329951971429573, 0, 0 },
+	{ "booger", "passwords", 198, 7.6293566200796095, 0, 7.6293566200796095, 0, 0 },
+	{ "jessie", "female_names", 214, 7.7414669864011474, 0, 7.7414669864011474, 0, 0 },
+	{ "jonathan", "male_names", 55, 5.7813597135246599, 0, 5.7813597135246599, 0, 0 },
+	{ "homer", "male_names", 287, 8.1649069266756875, 0, 8.1649069266756875, 0, 0 },
+	{ "pussycat", "passwords", 722, 9.4958550268871704, 0, 9.4958550268871704, 0, 0 },
+	{ "whatever", "passwords", 105, 6.7142455176661224, 0, 6.7142455176661224, 0, 0 },
+	{ "michael", "male_names", 4, 2, 0, 2, 0, 0 },
+	{ "diesel", "passwords", 507, 8.9858419370033413, 0, 8.9858419370033413, 0, 0 },
+	{ "walker", "surnames", 24, 4.5849625007211561, 0, 4.5849625007211561, 0, 0 },
+	{ "shorty", "passwords", 454, 8.8265484872909141, 0, 8.8265484872909141, 0, 0 },
+	{ "december", "passwords", 363, 8.5038257379957507, 0, 8.5038257379957507, 0, 0 },
+	{ "giants", "passwords", 212, 7.7279204545631988, 0, 7.7279204545631988, 0, 0 },
+	{ "dave", "male_names", 249, 7.9600019320680806, 0, 7.9600019320680806, 0, 0 },
+	{ "batman", "passwords", 33, 5.0443941193584534, 0, 5.0443941193584534, 0, 0 },
+	{ "qwertyui", "passwords", 256, 8, 0, 8, 0, 0 },
+	{ "123456", "passwords", 2, 1, 0, 1, 0, 0 },
+	{ "hard", "english", 313, 8.2900188469326181, 0, 8.2900188469326181, 0, 0 },
+	{ "brian", "male_names", 20, 4.3219280948873626, 0, 4.3219280948873626, 0, 0 },
+	{ "420420", "passwords", 493, 8.9454438363779119, 0, 8.9454438363779119, 0, 0 },
+	{ "vampire", "passwords", 395, 8.6257088430644657, 0, 8.6257088430644657, 0, 0 },
+	{ "cameron", "passwords", 189, 7.5622424242210728, 0, 7.5622424242210728, 0, 0 },
+	{ "alabama", "passwords", 771, 9.590587049915035, 0, 9.590587049915035, 0, 0 },
+	{ "asdfg", "passwords", 651, 9.3465137331656347, 0, 9.3465137331656347, 0, 0 },
+	{ "redwings", "passwords", 375, 8.5507467853832431, 0, 8.5507467853832431, 0, 0 },
+	{ "summer", "passwords", 63, 5.9772799234999168, 0, 5.9772799234999168, 0, 0 },
+	{ "fucking", "passwords", 223, 7.8008998999203047, 0, 7.8008998999203047, 0, 0 },
+	{ "everton", "passwords", 636, 9.3128829552843548, 0, 9.3128829552843548, 0, 0 },
+	{ "alexis", "passwords", 264, 8.0443941193584543, 0, 8.0443941193584543, 0, 0 },
+	{ "matt", "male_names", 295, 8.2045711442492042, 0, 8.2045711442492042, 0, 0 },
+	{ "phoenix", "passwords", 88, 6.4594316186372973, 0, 6.4594316186372973, 0, 0 },
+	{ "fred", "male_names", 71, 6.1497471195046822, 0, 6.1497471195046822, 0, 0 },
+	{ "system", "passwords", 550, 9.1032878084120217, 0, 9.1032878084120217, 0, 0 },
+	{ "jessica", "female_names", 26, 4.7004397181410917, 0, 4.7004397181410917, 0, 0 },
+	{ "ashley", "female_names", 63, 5.9772799234999168, 0, 5.9772799234999168, 0, 0 },
+	{ "molly", "female_names", 313, 8.2900188469326181, 0, 8.2900188469326181, 0, 0 },
+	{ "slipknot", "passwords", 419, 8.7108064336993518, 0, 8.7108064336993518, 0, 0 },
+	{ "corvette", "passwords", 64, 6, 0, 6, 0, 0 },
+	{ "duncan", "surnames", 165, 7.366322214245816, 0, 7.366322214245816, 0, 0 },
+	{ "coyote", "passwords", 749, 9.5488219084587502, 0, 9.5488219084587502, 0, 0 },
+	{ "spike", "passwords", 707, 9.4655664048093993, 0, 9.4655664048093993, 0, 0 },
+	{ "thomas", "male_names", 10, 3.3219280948873622, 0, 3.3219280948873622, 0, 0 },
+	{ "dude", "passwords", 500, 8.965784284662087, 0, 8.965784284662087, 0, 0 },
+	{ "transam", "passwords", 790, 9.6257088430644657, 0, 9.6257088430644657, 0, 0 },
+	{ "vision", "passwords", 543, 9.0848083878043617, 0, 9.0848083878043617, 0, 0 },
+	{ "arthur", "male_names", 48, 5.5849625007211561, 0, 5.5849625007211561, 0, 0 },
+	{ "hammer", "passwords", 62, 5.9541963103868749, 0, 5.9541963103868749, 0, 0 },
+	{ "rock", "passwords", 321, 8.3264294871223026, 0, 8.3264294871223026, 0, 0 },
+	{ "nathan", "male_names", 106, 6.7279204545631988, 0, 6.7279204545631988, 0, 0 },
+	{ "alyssa", "female_names", 433, 8.7582232147267245, 0, 8.7582232147267245, 0, 0 },
+	{ "wizard", "passwords", 128, 7, 0, 7, 0, 0 },
+	{ "enjoy", "passwords", 552, 9.1085244567781682, 0, 9.1085244567781682, 0, 0 },
+	{ "boogie", "passwords", 554, 9.1137421660491889, 0, 9.1137421660491889, 0, 0 },
+	{ "bonnie", "female_names", 88, 6.4594316186372973, 0, 6.4594316186372973, 0, 0 },
+	{ "murphy", "surnames", 57, 5.8328900141647413, 0, 5.8328900141647413, 0, 0 },
+	{ "lawrence", "male_names", 63, 5.9772799234999168, 0, 5.9772799234999168, 0, 0 },
+	{ "windows", "passwords", 528, 9.0443941193584543, 0, 9.0443941193584543, 0, 0 },
+	{ "edward", "male_names", 19, 4.2479275134435852, 0, 4.2479275134435852, 0, 0 },
+	{ "asdfasdf", "passwords", 310, 8.2761244052742384, 0, 8.2761244052742384, 0, 0 },
+	{ "great", "english", 162, 7.3398500028846243, 0, 7.3398500028846243, 0, 0 },
+	{ "jason", "male_names", 24, 4.5849625007211561, 0, 4.5849625007211561, 0, 0 },
+	{ "caesar", "passwords", 765, 9.5793159375800148, 0, 9.5793159375800148, 0, 0 },
+	{ "stella", "female_names", 245, 7.936637939002571, 0, 7.936637939002571, 0, 0 },
+	{ "scott", "male_names", 32, 5, 0, 5, 0, 0 },
+	{ "changeme", "passwords", 764, 9.5774288280357496, 0, 9.5774288280357496, 0, 0 },
+	{ "digger", "passwords", 623, 9.2830883530240023, 0, 9.2830883530240023, 0, 0 },
+	{ "wombat", "passwords", 622, 9.2807707701306033, 0, 9.2807707701306033, 0, 0 },
+	{ "raiders", "passwords", 155, 7.2761244052742375, 0, 7.2761244052742375, 0, 0 },
+	{ "allison", "female_names", 226, 7.8201789624151878, 0, 7.8201789624151878, 0, 0 },
+	{ "chris", "male_names", 94, 6.5545888516776376, 0, 6.5545888516776376, 0, 0 },
+	{ "women", "english", 575, 9.1674181458317374, 0, 9.1674181458317374, 0, 0 },
+	{ "college", "passwords", 414, 8.6934869574993261, 0, 8.6934869574993261, 0, 0 },
+	{ "denise", "female_names", 74, 6.2094533656289501, 0, 6.2094533656289501, 0, 0 },
+	{ "brown", "surnames", 5, 2.3219280948873622, 0, 2.3219280948873622, 0, 0 },
+	{ "genesis", "passwords", 410, 8.6794800995054455, 0, 8.6794800995054455, 0, 0 },
+	{ "welcome", "passwords", 125, 6.965784284662087, 0, 6.965784284662087, 0, 0 },
+	{ "whore", "passwords", 605, 9.2407913321619564, 0, 9.2407913321619564, 0, 0 },
+	{ "donald", "male_names", 15, 3.9068905956085187, 0, 3.9068905956085187, 0, 0 },
+	{ "honey", "english", 292, 8.1898245588800176, 0, 8.1898245588800176, 0, 0 },
+	{ "nintendo", "passwords", 467, 8.8672787397096613, 0, 8.8672787397096613, 0, 0 },
+	{ "monster", "passwords", 137, 7.0980320829605263, 0, 7.0980320829605263, 0, 0 },
+	{ "brandy", "passwords", 133, 7.0552824355011898, 0, 7.0552824355011898, 0, 0 },
+	{ "platinum", "passwords", 325, 8.3442959079158161, 0, 8.3442959079158161, 0, 0 },
+	{ "simon", "male_names", 358, 8.4838157772642564, 0, 8.4838157772642564, 0, 0 },
+	{ "england", "surnames", 831, 9.6987046667703449, 0, 9.6987046667703449, 0, 0 },
+	{ "online", "passwords", 367, 8.5196362528432132, 0, 8.5196362528432132, 0, 0 },
+	{ "dancer", "passwords", 561, 9.1318569606087934, 0, 9.1318569606087934, 0, 0 },
+	{ "scarface", "passwords", 675, 9.3987436919381935, 0, 9.3987436919381935, 0, 0 },
+	{ "dustin", "male_names", 169, 7.4008794362821844, 0, 7.4008794362821844, 0, 0 },
+	{ "rascal", "passwords", 577, 9.1724275086454821, 0, 9.1724275086454821, 0, 0 },
+	{ "nipples", "passwords", 506, 8.9829935746943104, 0, 8.9829935746943104, 0, 0 },
+	{ "friends", "english", 332, 8.3750394313469254, 0, 8.3750394313469254, 0, 0 },
+	{ "flash", "passwords", 540, 9.0768155970508317, 0, 9.0768155970508317, 0, 0 },
+	{ "spider", "passwords", 138, 7.1085244567781691, 0, 7.1085244567781691, 0, 0 },
+	{ "252525", "passwords", 708, 9.4676055500829968, 0, 9.4676055500829968, 0, 0 },
+	{ "party", "english", 410, 8.6794800995054455, 0, 8.6794800995054455, 0, 0 },
+	{ "saints", "passwords", 587, 9.1972166931100521, 0, 9.1972166931100521, 0, 0 },
+	{ "lakers", "passwords", 139, 7.1189410727235076, 0, 7.1189410727235076, 0, 0 },
+	{ "tiger", "passwords", 147, 7.1996723448363644, 0, 7.1996723448363644, 0, 0 },
+	{ "florida", "passwords", 243, 7.9248125036057813, 0, 7.9248125036057813, 0, 0 },
+	{ "flowers", "surnames", 362, 8.4998458870832057, 0, 8.4998458870832057, 0, 0 },
+	{ "therock", "passwords", 366, 8.5156998382840428, 0, 8.5156998382840428, 0, 0 },
+	{ "beavis", "passwords", 281, 8.1344263202209266, 0, 8.1344263202209266, 0, 0 },
+	{ "alison", "female_names", 341, 8.4136279290241731, 0, 8.4136279290241731, 0, 0 },
+	{ "danielle", "female_names", 150, 7.2288186904958804, 0, 7.2288186904958804, 0, 0 },
+	{ "alexande", "passwords", 413, 8.6899979714194462, 0, 8.6899979714194462, 0, 0 },
+	{ "japan", "passwords", 720, 9.4918530963296739, 0, 9.4918530963296739, 0, 0 },
+	{ "moose", "passwords", 747, 9.5449644327892376, 0, 9.5449644327892376, 0, 0 },
+	{ "eagle", "passwords", 392, 8.6147098441152075, 0, 8.6147098441152075, 0, 0 },
+	{ "internet", "passwords", 131, 7.0334230015374501, 0, 7.0334230015374501, 0, 0 },
+	{ "pervert", "passwords", 680, 9.4093909361377026, 0, 9.4093909361377026, 0, 0 },
+	{ "gregory", "male_names", 37, 5.2094533656289501, 0, 5.2094533656289501, 0, 0 },
+	{ "roland", "male_names", 210, 7.7142455176661224, 0, 7.7142455176661224, 0, 0 },
+	{ "marvin", "male_names", 112, 6.8073549220576037, 0, 6.8073549220576037, 0, 0 },
+	{ "creative", "passwords", 431, 8.7515440590890989, 0, 8.7515440590890989, 0, 0 },
+	{ "bigmac", "passwords", 709, 9.4696418172395163, 0, 9.4696418172395163, 0, 0 },
+	{ "redhead", "passwords", 681, 9.411510988012072, 0, 9.411510988012072, 0, 0 },
+	{ "girls", "passwords", 190, 7.5698556083309478, 0, 7.5698556083309478, 0, 0 },
+	{ "hotrod", "passwords", 411, 8.6829945836816833, 0, 8.6829945836816833, 0, 0 },
+	{ "marines", "passwords", 555, 9.1163439612374688, 0, 9.1163439612374688, 0, 0 },
+	{ "infinity", "passwords", 750, 9.5507467853832431, 0, 9.5507467853832431, 0, 0 },
+	{ "raven", "passwords", 674, 9.3966047811818587, 0, 9.3966047811818587, 0, 0 },
+	{ "adrian", "male_names", 212, 7.7279204545631988, 0, 7.7279204545631988, 0, 0 },
+	{ "pussy", "passwords", 8, 3, 0, 3, 0, 0 },
+	{ "kelly", "female_names", 67, 6.0660891904577721, 0, 6.0660891904577721, 0, 0 },
+	{ "jennifer", "female_names", 6, 2.5849625007211561, 0, 2.5849625007211561, 0, 0 },
+	{ "garcia", "surnames", 17, 4.0874628412503391, 0, 4.0874628412503391, 0, 0 },
+	{ "katie", "female_names", 192, 7.5849625007211561, 0, 7.5849625007211561, 0, 0 },
+	{ "inside", "english", 507, 8.9858419370033413, 0, 8.9858419370033413, 0, 0 },
+	{ "darkness", "passwords", 445, 8.7976615258537603, 0, 8.7976615258537603, 0, 0 },
+	{ "sabrina", "female_names", 308, 8.2667865406949019, 0, 8.2667865406949019, 0, 0 },
+	{ "ladies", "passwords", 514, 9.0056245491938789, 0, 9.0056245491938789, 0, 0 },
+	{ "angela", "female_names", 29, 4.8579809951275719, 0, 4.8579809951275719, 0, 0 },
+	{ "scorpio", "passwords", 287, 8.1649069266756875, 0, 8.1649069266756875, 0, 0 },
+	{ "passport", "passwords", 607, 9.2455527062556815, 0, 9.2455527062556815, 0, 0 },
+	{ "turtle", "passwords", 206, 7.6865005271832185, 0, 7.6865005271832185, 0, 0 },
+	{ "nissan", "passwords", 350, 8.451211111832329, 0, 8.451211111832329, 0, 0 },
+	{ "bollocks", "passwords", 435, 8.7648715907360906, 0, 8.7648715907360906, 0, 0 },
+	{ "cheryl", "female_names", 59, 5.8826430493618416, 0, 5.8826430493618416, 0, 0 },
+	{ "paradise", "passwords", 484, 8.9188632372745946, 0, 8.9188632372745946, 0, 0 },
+	{ "nick", "male_names", 277, 8.1137421660491889, 0, 8.1137421660491889, 0, 0 },
+	{ "suckit", "passwords", 229, 7.8392037880969436, 0, 7.8392037880969436, 0, 0 },
+	{ "sucks", "passwords", 762, 9.5736471874933216, 0, 9.5736471874933216, 0, 0 },
+	{ "connie", "female_names", 106, 6.7279204545631988, 0, 6.7279204545631988, 0, 0 },
+	{ "booboo", "passwords", 121, 6.9188632372745946, 0, 6.9188632372745946, 0, 0 },
+	{ "pavilion", "passwords", 763, 9.5755392468345306, 0, 9.5755392468345306, 0, 0 },
+	{ "america", "passwords", 341, 8.4136279290241731, 0, 8.4136279290241731, 0, 0 },
+	{ "drowssap", "passwords", 501, 8.968666793195208, 0, 8.968666793195208, 0, 0 },
+	{ "dennis", "male_names", 40, 5.3219280948873626, 0, 5.3219280948873626, 0, 0 },
+	{ "hardon", "passwords", 562, 9.1344263202209266, 0, 9.1344263202209266, 0, 0 },
+	{ "oliver", "surnames", 194, 7.5999128421871278, 0, 7.5999128421871278, 0, 0 },
+	{ "burton", "surnames", 209, 7.7073591320808825, 0, 7.7073591320808825, 0, 0 },
+	{ "passion", "passwords", 512, 9, 0, 9, 0, 0 },
+	{ "sandman", "passwords", 449, 8.8105716347411462, 0, 8.8105716347411462, 0, 0 },
+	{ "vikings", "passwords", 464, 8.8579809951275728, 0, 8.8579809951275728, 0, 0 },
+	{ "shooter", "passwords", 692, 9.4346282276367255, 0, 9.4346282276367255, 0, 0 },
+	{ "147147", "passwords", 517, 9.014020470314934, 0, 9.014020470314934, 0, 0 },
+	{ "ironman", "passwords", 566, 9.1446582428318823, 0, 9.1446582428318823, 0, 0 },
+	{ "tigger", "passwords", 30, 4.9068905956085187, 0, 4.9068905956085187, 0, 0 },
+	{ "private", "passwords", 317, 8.3083390301394076, 0, 8.3083390301394076, 0, 0 },
+	{ "people", "english", 149, 7.2191685204621612, 0, 7.2191685204621612, 0, 0 },
+	{ "2000", "passwords", 19, 4.2479275134435852, 0, 4.2479275134435852, 0, 0 },
+	{ "topgun", "passwords", 309, 8.2714630279043746, 0, 8.2714630279043746, 0, 0 },
+	{ "suckme", "passwords", 516, 9.011227255423254, 0, 9.011227255423254, 0, 0 },
+	{ "turkey", "passwords", 629, 9.2969162068792883, 0, 9.2969162068792883, 0, 0 },
+	{ "britney", "passwords", 669, 9.3858624006414608, 0, 9.3858624006414608, 0, 0 },
+	{ "maddog", "passwords", 195, 7.6073303137496104, 0, 7.6073303137496104, 0, 0 },
+	{ "shadow", "passwords", 16, 4, 0, 4, 0, 0 },
+	{ "ryan", "male_names", 49, 5.6147098441152083, 0, 5.6147098441152083, 0, 0 },
+	{ "jester", "passwords", 415, 8.6969675262342871, 0, 8.6969675262342871, 0, 0 },
+	{ "hotdog", "passwords", 236, 7.8826430493618416, 0, 7.8826430493618416, 0, 0 },
+	{ "golden", "passwords", 183, 7.5156998382840428, 0, 7.5156998382840428, 0, 0 },
+	{ "doctor", "passwords", 247, 7.9483672315846778, 0, 7.9483672315846778, 0, 0 },
+	{ "spirit", "passwords", 529, 9.0471239121140261, 0, 9.0471239121140261, 0, 0 },
+	{ "apollo", "passwords", 278, 8.1189410727235067, 0, 8.1189410727235067, 0, 0 },
+	{ "trevor", "male_names", 285, 8.1548181090521048, 0, 8.1548181090521048, 0, 0 },
+	{ "trucker", "passwords", 797, 9.6384359139904721, 0, 9.6384359139904721, 0, 0 },
+	{ "calvin", "male_names", 150, 7.2288186904958804, 0, 7.2288186904958804, 0, 0 },
+	{ "patches", "passwords", 532, 9.0552824355011889, 0, 9.0552824355011889, 0, 0 },
+	{ "jones", "surnames", 4, 2, 0, 2, 0, 0 },
+	{ "hawkeye", "passwords", 739, 9.5294305541461508, 0, 9.5294305541461508, 0, 0 },
+	{ "virginia", "female_names", 35, 5.1292830169449664, 0, 5.1292830169449664, 0, 0 },
+	{ "machine", "passwords", 743, 9.5372184005385954, 0, 9.5372184005385954, 0, 0 },
+	{ "bigtits", "passwords", 153, 7.2573878426926521, 0, 7.2573878426926521, 0, 0 },
+	{ "rainbow", "passwords", 260, 8.0223678130284544, 0, 8.0223678130284544, 0, 0 },
+	{ "bond007", "passwords", 273, 8.0927571409198524, 0, 8.0927571409198524, 0, 0 },
+	{ "pimpin", "passwords", 391, 8.611024797307353, 0, 8.611024797307353, 0, 0 },
+	{ "hooters", "passwords", 192, 7.5849625007211561, 0, 7.5849625007211561, 0, 0 },
+	{ "liverpool", "passwords", 634, 9.3083390301394076, 0, 9.3083390301394076, 0, 0 },
+	{ "vincent", "male_names", 113, 6.8201789624151878, 0, 6.8201789624151878, 0, 0 },
+	{ "nicole", "female_names", 68, 6.0874628412503391, 0, 6.0874628412503391, 0, 0 },
+	{ "courtney", "female_names", 243, 7.9248125036057813, 0, 7.9248125036057813, 0, 0 },
+	{ "kevin", "male_names", 23, 4.5235619560570131, 0, 4.5235619560570131, 0, 0 },
+	{ "badger", "passwords", 483, 8.9158793788357737, 0, 8.9158793788357737, 0, 0 },
+	{ "thumper", "passwords", 442, 8.7879025593914317, 0, 8.7879025593914317, 0, 0 },
+	{ "beatles", "passwords", 403, 8.6546360285279675, 0, 8.6546360285279675, 0, 0 },
+	{ "walter", "male_names", 41, 5.3575520046180838, 0, 5.3575520046180838, 0, 0 },
+	{ "madonna", "passwords", 778, 9.6036263449861927, 0, 9.6036263449861927, 0, 0 },
+	{ "tweety", "passwords", 787, 9.6202198255074869, 0, 9.6202198255074869, 0, 0 },
+	{ "white", "surnames", 13, 3.7004397181410922, 0, 3.7004397181410922, 0, 0 },
+	{ "qwer", "passwords", 655, 9.3553510964248119, 0, 9.3553510964248119, 0, 0 },
+	{ "michigan", "passwords", 377, 8.5584207132686636, 0, 8.5584207132686636, 0, 0 },
+	{ "fisher", "surnames", 107, 6.7414669864011474, 0, 6.7414669864011474, 0, 0 },
+	{ "sandra", "female_names", 16, 4, 0, 4, 0, 0 },
+	{ "fish", "passwords", 255, 7.9943534368588578, 0, 7.9943534368588578, 0, 0 },
+	{ "fuckoff", "passwords", 234, 7.8703647195834048, 0, 7.8703647195834048, 0, 0 },
+	{ "fuck", "passwords", 32, 5, 0, 5, 0, 0 },
+	{ "ncc1701d", "passwords", 666, 9.3793783670712614, 0, 9.3793783670712614, 0, 0 },
+	{ "apples", "passwords", 254, 7.9886846867721655, 0, 7.9886846867721655, 0, 0 },
+	{ "jake", "passwords", 326, 8.3487281542310772, 0, 8.3487281542310772, 0, 0 },
+	{ "banana", "passwords", 136, 7.0874628412503391, 0, 7.0874628412503391, 0, 0 },
+	{ "leather", "passwords", 472, 8.8826430493618407, 0, 8.8826430493618407, 0, 0 },
+	{ "bishop", "surnames", 201, 7.651051691178929, 0, 7.651051691178929, 0, 0 },
+	{ "bulldogs", "passwords", 625, 9.2877123795494487, 0, 9.2877123795494487, 0, 0 },
+	{ "penis", "passwords", 372, 8.539158811108031, 0, 8.539158811108031, 0, 0 },
+	{ "hardcore", "passwords", 118, 6.8826430493618416, 0, 6.8826430493618416, 0, 0 },
+	{ "whynot", "passwords", 662, 9.3706874068072175, 0, 9.3706874068072175, 0, 0 },
+	{ "eugene", "male_names", 79, 6.3037807481771031, 0, 6.3037807481771031, 0, 0 },
+	{ "dexter", "male_names", 405, 8.6617780977719878, 0, 8.6617780977719878, 0, 0 },
+	{ "dirty", "passwords", 557, 9.1215335173400316, 0, 9.1215335173400316, 0, 0 },
+	{ "victoria", "female_names", 116, 6.8579809951275719, 0, 6.8579809951275719, 0, 0 },
+	{ "stingray", "passwords", 691, 9.4325419003882587, 0, 9.4325419003882587, 0, 0 },
+	{ "cocacola", "passwords", 269, 8.0714623625566233, 0, 8.0714623625566233, 0, 0 },
+	{ "control", "english", 597, 9.2215871212648057, 0, 9.2215871212648057, 0, 0 },
+	{ "victor", "male_names", 83, 6.3750394313469245, 0, 6.3750394313469245, 0, 0 },
+	{ "stewart", "surnames", 49, 5.6147098441152083, 0, 5.6147098441152083, 0, 0 },
+	{ "john", "male_names", 2, 1, 0, 1, 0, 0 },
+	{ "wutang", "passwords", 769, 9.5868397879618268, 0, 9.5868397879618268, 0, 0 },
+	{ "thx1138", "passwords", 172, 7.4262647547020979, 0, 7.4262647547020979, 0, 0 },
+	{ "boomer", "passwords", 104, 6.7004397181410917, 0, 6.7004397181410917, 0, 0 },
+	{ "phantom", "passwords", 320, 8.3219280948873617, 0, 8.3219280948873617, 0, 0 },
+	{ "willie", "male_names", 61, 5.9307373375628867, 0, 5.9307373375628867, 0, 0 },
+	{ "brenda", "female_names", 31, 4.9541963103868749, 0, 4.9541963103868749, 0, 0 },
+	{ "chevelle", "passwords", 637, 9.3151495622563001, 0, 9.3151495622563001, 0, 0 },
+	{ "assman", "passwords", 466, 8.8641861446542798, 0, 8.8641861446542798, 0, 0 },
+	{ "sierra", "passwords", 210, 7.7142455176661224, 0, 7.7142455176661224, 0, 0 },
+	{ "service", "passwords", 704, 9.4594316186372964, 0, 9.4594316186372964, 0, 0 },
+	{ "mustang", "passwords", 15, 3.9068905956085187, 0, 3.9068905956085187, 0, 0 },
+	{ "sailor", "passwords", 717, 9.4858293087019039, 0, 9.4858293087019039, 0, 0 },
+	{ "aaaaaa", "passwords", 89, 6.4757334309663976, 0, 6.4757334309663976, 0, 0 },
+	{ "rooster", "passwords", 597, 9.2215871212648057, 0, 9.2215871212648057, 0, 0 },
+	{ "stinky", "passwords", 524, 9.0334230015374501, 0, 9.0334230015374501, 0, 0 },
+	{ "maximus", "passwords", 541, 9.0794847838268158, 0, 9.0794847838268158, 0, 0 },
+	{ "chicken", "passwords", 112, 6.8073549220576037, 0, 6.8073549220576037, 0, 0 },
+	{ "seattle", "passwords", 792, 9.6293566200796104, 0, 9.6293566200796104, 0, 0 },
+	{ "poop", "passwords", 486, 8.9248125036057804, 0, 8.9248125036057804, 0, 0 },
+	{ "wolfgang", "passwords", 729, 9.5097750043269365, 0, 9.5097750043269365, 0, 0 },
+	{ "flyers", "passwords", 295, 8.2045711442492042, 0, 8.2045711442492042, 0, 0 },
+	{ "chopper", "passwords", 660, 9.366322214245816, 0, 9.366322214245816, 0, 0 },
+	{ "dick", "passwords", 113, 6.8201789624151878, 0, 6.8201789624151878, 0, 0 },
+	{ "carolina", "passwords", 429, 8.7448338374995451, 0, 8.7448338374995451, 0, 0 },
+	{ "bobby", "male_names", 82, 6.3575520046180838, 0, 6.3575520046180838, 0, 0 },
+	{ "bitches", "passwords", 307, 8.2620948453701786, 0, 8.2620948453701786, 0, 0 },
+	{ "girl", "english", 276, 8.1085244567781682, 0, 8.1085244567781682, 0, 0 },
+	{ "boobs", "passwords", 296, 8.2094533656289492, 0, 8.2094533656289492, 0, 0 },
+	{ "raymond", "male_names", 36, 5.1699250014423122, 0, 5.1699250014423122, 0, 0 },
+	{ "hello", "passwords", 54, 5.7548875021634682, 0, 5.7548875021634682, 0, 0 },
+	{ "mercury", "passwords", 574, 9.1649069266756875, 0, 9.1649069266756875, 0, 0 },
+	{ "elvis", "male_names", 560, 9.1292830169449672, 0, 9.1292830169449672, 0, 0 },
+	{ "patrick", "male_names", 42, 5.3923174227787607, 0, 5.3923174227787607, 0, 0 },
+	{ "tucker", "surnames", 122, 6.9307373375628867, 0, 6.9307373375628867, 0, 0 },
+	{ "dakota", "passwords", 109, 6.768184324776926, 0, 6.768184324776926, 0, 0 },
+	{ "love", "passwords", 39, 5.2854022188622487, 0, 5.2854022188622487, 0, 0 },
+	{ "orange", "passwords", 55, 5.7813597135246599, 0, 5.7813597135246599, 0, 0 },
+	{ "fireman", "passwords", 546, 9.0927571409198524, 0, 9.0927571409198524, 0, 0 },
+	{ "monica", "female_names", 131, 7.0334230015374501, 0, 7.0334230015374501, 0, 0 },
+	{ "zxcvbnm", "passwords", 176, 7.4594316186372973, 0, 7.4594316186372973, 0, 0 },
+	{ "mookie", "passwords", 598, 9.2240016741981048, 0, 9.2240016741981048, 0, 0 },
+	{ "review", "passwords", 802, 9.6474584264549197, 0, 9.6474584264549197, 0, 0 },
+	{ "shithead", "passwords", 233, 7.8641861446542807, 0, 7.8641861446542807, 0, 0 },
+	{ "berlin", "passwords", 725, 9.5018371849022962, 0, 9.5018371849022962, 0, 0 },
+	{ "bigone", "passwords", 780, 9.6073303137496104, 0, 9.6073303137496104, 0, 0 },
+	{ "enigma", "passwords", 495, 8.9512847149669721, 0, 8.9512847149669721, 0, 0 },
+	{ "justin", "male_names", 56, 5.8073549220576037, 0, 5.8073549220576037, 0, 0 },
+	{ "freeuser", "passwords", 522, 9.0279059965698849, 0, 9.0279059965698849, 0, 0 },
+	{ "harley", "passwords", 22, 4.4594316186372973, 0, 4.4594316186372973, 0, 0 },
+	{ "scooby", "passwords", 129, 7.011227255423254, 0, 7.011227255423254, 0, 0 },
+	{ "marina", "female_names", 479, 8.9038818457361799, 0, 8.9038818457361799, 0, 0 },
+	{ "trustno1", "passwords", 27, 4.7548875021634682, 0, 4.7548875021634682, 0, 0 },
+	{ "morris", "surnames", 51, 5.6724253419714952, 0, 5.6724253419714952, 0, 0 },
+	{ "good", "english", 68, 6.0874628412503391, 0, 6.0874628412503391, 0, 0 },
+	{ "brooklyn", "passwords", 369, 8.5274770060603959, 0, 8.5274770060603959, 0, 0 },
+	{ "august", "passwords", 322, 8.3309168781146177, 0, 8.3309168781146177, 0, 0 },
+	{ "dodgers", "passwords", 741, 9.5333297323058339, 0, 9.5333297323058339, 0, 0 },
+	{ "poohbear", "passwords", 460, 8.8454900509443757, 0, 8.8454900509443757, 0, 0 },
+	{ "jeffrey", "male_names", 30, 4.9068905956085187, 0, 4.9068905956085187, 0, 0 },
+	{ "mike", "male_names", 103, 6.6865005271832185, 0, 6.6865005271832185, 0, 0 },
+	{ "amanda", "female_names", 40, 5.3219280948873626, 0, 5.3219280948873626, 0, 0 },
+	{ "willow", "passwords", 332, 8.3750394313469254, 0, 8.3750394313469254, 0, 0 },
+	{ "spencer", "surnames", 152, 7.2479275134435852, 0, 7.2479275134435852, 0, 0 },
+	{ "einstein", "passwords", 393, 8.6183855022586062, 0, 8.6183855022586062, 0, 0 },
+	{ "pokemon", "passwords", 544, 9.0874628412503391, 0, 9.0874628412503391, 0, 0 },
+	{ "general", "passwords", 606, 9.2431739834729516, 0, 9.2431739834729516, 0, 0 },
+	{ "chance", "english", 356, 8.4757334309663985, 0, 8.4757334309663985, 0, 0 },
+	{ "helpme", "passwords", 222, 7.7944158663501062, 0, 7.7944158663501062, 0, 0 },
+	{ "testing", "passwords", 272, 8.0874628412503391, 0, 8.0874628412503391, 0, 0 },
+	{ "sniper", "passwords", 409, 8.6759570329417492, 0, 8.6759570329417492, 0, 0 },
+	{ "little", "english", 105, 6.7142455176661224, 0, 6.7142455176661224, 0, 0 },
+	{ "fucked", "passwords", 563, 9.1369911120802296, 0, 9.1369911120802296, 0, 0 },
+	{ "saturn", "passwords", 352, 8.4594316186372964, 0, 8.4594316186372964, 0, 0 },
+	{ "bondage", "passwords", 588, 9.1996723448363635, 0, 9.1996723448363635, 0, 0 },
+	{ "peaches", "passwords", 253, 7.9829935746943104, 0, 7.9829935746943104, 0, 0 },
+	{ "happy1", "passwords", 617, 9.2691266791494176, 0, 9.2691266791494176, 0, 0 },
+	{ "ginger", "passwords", 61, 5.9307373375628867, 0, 5.9307373375628867, 0, 0 },
+	{ "peanut", "passwords", 96, 6.5849625007211561, 0, 6.5849625007211561, 0, 0 },
+	{ "eagles", "passwords", 111, 6.7944158663501062, 0, 6.7944158663501062, 0, 0 },
+	{ "rocks", "passwords", 508, 8.9886846867721655, 0, 8.9886846867721655, 0, 0 },
+	{ "christ", "passwords", 619, 9.2737955992142638, 0, 9.2737955992142638, 0, 0 },
+	{ "sweet", "passwords", 365, 8.5117526537673793, 0, 8.5117526537673793, 0, 0 },
+	{ "loverboy", "passwords", 724, 9.4998458870832057, 0, 9.4998458870832057, 0, 0 },
+	{ "secret", "passwords", 77, 6.266786540694901, 0, 6.266786540694901, 0, 0 },
+	{ "golfer", "passwords", 70, 6.1292830169449664, 0, 6.1292830169449664, 0, 0 },
+	{ "lucky", "passwords", 225, 7.8137811912170374, 0, 7.8137811912170374, 0, 0 },
+	{ "juan", "male_names", 52, 5.7004397181410917, 0, 5.7004397181410917, 0, 0 },
+	{ "france", "passwords", 693, 9.4367115421372141, 0, 9.4367115421372141, 0, 0 },
+	{ "young", "surnames", 27, 4.7548875021634682, 0, 4.7548875021634682, 0, 0 },
+	{ "empire", "passwords", 650, 9.3442959079158161, 0, 9.3442959079158161, 0, 0 },
+	{ "maggie", "passwords", 47, 5.5545888516776376, 0, 5.5545888516776376, 0, 0 },
+	{ "diamond", "passwords", 74, 6.2094533656289501, 0, 6.2094533656289501, 0, 0 },
+	{ "yankee", "passwords", 303, 8.2431739834729516, 0, 8.2431739834729516, 0, 0 },
+	{ "hannah", "passwords", 167, 7.3837042924740519, 0, 7.3837042924740519, 0, 0 },
+	{ "adidas", "passwords", 357, 8.4797802640290989, 0, 8.4797802640290989, 0, 0 },
+	{ "shaggy", "passwords", 653, 9.3509391815464316, 0, 9.3509391815464316, 0, 0 },
+	{ "butthead", "passwords", 184, 7.5235619560570131, 0, 7.5235619560570131, 0, 0 },
+	{ "dolphin", "passwords", 271, 8.0821490413538708, 0, 8.0821490413538708, 0, 0 },
+	{ "sammy", "passwords", 323, 8.3353903546939243, 0, 8.3353903546939243, 0, 0 },
+	{ "arnold", "surnames", 159, 7.3128829552843557, 0, 7.3128829552843557, 0, 0 },
+	{ "mexico", "passwords", 402, 8.6510516911789281, 0, 8.6510516911789281, 0, 0 },
+	{ "booty", "passwords", 504, 8.9772799234999159, 0, 8.9772799234999159, 0, 0 },
+	{ "cumshot", "passwords", 330, 8.366322214245816, 0, 8.366322214245816, 0, 0 },
+	{ "denver", "male_names", 619, 9.2737955992142638, 0, 9.2737955992142638, 0, 0 },
+	{ "scotland", "passwords", 595, 9.2167458581953063, 0, 9.2167458581953063, 0, 0 },
+	{ "tommy", "male_names", 156, 7.2854022188622487, 0, 7.2854022188622487, 0, 0 },
+	{ "cobra", "passwords", 551, 9.105908508571158, 0, 9.105908508571158, 0, 0 },
+	{ "peekaboo", "passwords", 581, 9.1823943534045291, 0, 9.1823943534045291, 0, 0 },
+	{ "magnum", "passwords", 379, 8.5660540381710923, 0, 8.5660540381710923, 0, 0 },
+	{ "heather", "female_names", 53, 5.7279204545631988, 0, 5.7279204545631988, 0, 0 },
+	{ "carter", "surnames", 38, 5.2479275134435852, 0, 5.2479275134435852, 0, 0 },
+	{ "crystal", "female_names", 102, 6.6724253419714952, 0, 6.6724253419714952, 0, 0 },
+	{ "spooky", "passwords", 480, 8.9068905956085178, 0, 8.9068905956085178, 0, 0 },
+	{ "william", "male_names", 5, 2.3219280948873622, 0, 2.3219280948873622, 0, 0 },
+	{ "gandalf", "passwords", 151, 7.2384047393250786, 0, 7.2384047393250786, 0, 0 },
+	{ "beach", "passwords", 456, 8.8328900141647413, 0, 8.8328900141647413, 0, 0 },
+	{ "weasel", "passwords", 620, 9.2761244052742384, 0, 9.2761244052742384, 0, 0 },
+	{ "star", "passwords", 293, 8.1947568544222484, 0, 8.1947568544222484, 0, 0 },
+	{ "freedom", "passwords", 57, 5.8328900141647413, 0, 5.8328900141647413, 0, 0 },
+	{ "bailey", "surnames", 58, 5.8579809951275719, 0, 5.8579809951275719, 0, 0 },
+	{ "snoopy", "passwords", 103, 6.6865005271832185, 0, 6.6865005271832185, 0, 0 },
+	{ "naughty", "passwords", 450, 8.8137811912170374, 0, 8.8137811912170374, 0, 0 },
+	{ "1q2w3e", "passwords", 422, 8.7210991887071856, 0, 8.7210991887071856, 0, 0 },
+	{ "marshall", "surnames", 113, 6.8201789624151878, 0, 6.8201789624151878, 0, 0 },
+	{ "amber", "female_names", 139, 7.1189410727235076, 0, 7.1189410727235076, 0, 0 },
+	{ "rosebud", "passwords", 245, 7.936637939002571, 0, 7.936637939002571, 0, 0 },
+	{ "trouble", "passwords", 248, 7.9541963103868749, 0, 7.9541963103868749, 0, 0 },
+	{ "outlaw", "passwords", 757, 9.5641494899857324, 0, 9.5641494899857324, 0, 0 },
+	{ "zachary", "male_names", 173, 7.4346282276367246, 0, 7.4346282276367246, 0, 0 },
+	{ "sublime", "passwords", 672, 9.3923174227787598, 0, 9.3923174227787598, 0, 0 },
+	{ "happy", "english", 273, 8.0927571409198524, 0, 8.0927571409198524, 0, 0 },
+	{ "iceman", "passwords", 106, 6.7279204545631988, 0, 6.7279204545631988, 0, 0 },
+	{ "animal", "passwords", 313, 8.2900188469326181, 0, 8.2900188469326181, 0, 0 },
+	{ "captain", "passwords", 194, 7.5999128421871278, 0, 7.5999128421871278, 0, 0 },
+	{ "steven", "male_names", 18, 4.1699250014423122, 0, 4.1699250014423122, 0, 0 },
+	{ "tester", "passwords", 280, 8.1292830169449672, 0, 8.1292830169449672, 0, 0 },
+	{ "cassie", "passwords", 407, 8.6688849842662474, 0, 8.6688849842662474, 0, 0 },
+	{ "marine", "passwords", 148, 7.2094533656289501, 0, 7.2094533656289501, 0, 0 },
+	{ "smooth", "passwords", 534, 9.0606959316875546, 0, 9.0606959316875546, 0, 0 },
+	{ "miller", "surnames", 7, 2.8073549220576042, 0, 2.8073549220576042, 0, 0 },
+	{ "claudia", "female_names", 232, 7.8579809951275719, 0, 7.8579809951275719, 0, 0 },
+	{ "buddha", "passwords", 448, 8.8073549220576037, 0, 8.8073549220576037, 0, 0 },
+	{ "single", "passwords", 711, 9.4737057496194161, 0, 9.4737057496194161, 0, 0 },
+	{ "password", "passwords", 1, 0, 0, 0, 0, 0 },
+	{ "video", "passwords", 488, 8.9307373375628867, 0, 8.9307373375628867, 0, 0 },
+	{ "monkey", "passwords", 12, 3.5849625007211561, 0, 3.5849625007211561, 0, 0 },
+	{ "panther", "passwords", 175, 7.451211111832329, 0, 7.451211111832329, 0, 0 },
+	{ "indigo", "passwords", 798, 9.640244936222345, 0, 9.640244936222345, 0, 0 },
+	{ "indian", "passwords", 547, 9.0953970227925574, 0, 9.0953970227925574, 0, 0 },
+	{ "pakistan", "passwords", 742, 9.5352753766208025, 0, 9.5352753766208025, 0, 0 },
+	{ "arizona", "passwords", 611, 9.2550285698187302, 0, 9.2550285698187302, 0, 0 },
+	{ "froggy", "passwords", 654, 9.353146825498083, 0, 9.353146825498083, 0, 0 },
+	{ "abc123", "passwords", 14, 3.8073549220576042, 0, 3.8073549220576042, 0, 0 },
+	{ "alex", "male_names", 151, 7.2384047393250786, 0, 7.2384047393250786, 0, 0 },
+	{ "panties", "passwords", 101, 6.6582114827517946, 0, 6.6582114827517946, 0, 0 },
+	{ "sophie", "passwords", 207, 7.6934869574993252, 0, 7.6934869574993252, 0, 0 },
+	{ "bowling", "passwords", 768, 9.5849625007211561, 0, 9.5849625007211561, 0, 0 },
+	{ "pandora", "passwords", 795, 9.6348110501717183, 0, 9.6348110501717183, 0, 0 },
+	{ "smith", "surnames", 1, 0, 0, 0, 0, 0 },
+	{ "airplane", "passwords", 668, 9.3837042924740519, 0, 9.3837042924740519, 0, 0 },
+	{ "fuckyou", "passwords", 26, 4.7004397181410917, 0, 4.7004397181410917, 0, 0 },
+	{ "spring", "passwords", 705, 9.4614794472861554, 0, 9.4614794472861554, 0, 0 },
+	{ "xavier", "passwords", 270, 8.0768155970508317, 0, 8.0768155970508317, 0, 0 },
+	{ "jerry", "male_names", 39, 5.2854022188622487, 0, 5.2854022188622487, 0, 0 },
+	{ "freaky", "passwords", 740, 9.5313814605163127, 0, 9.5313814605163127, 0, 0 },
+	{ "american", "passwords", 682, 9.4136279290241731, 0, 9.4136279290241731, 0, 0 },
+	{ "kodiak", "passwords", 657, 9.3597495603223297, 0, 9.3597495603223297, 0, 0 },
+	{ "pumpkin", "passwords", 398, 8.6366246205436497, 0, 8.6366246205436497, 0, 0 },
+	{ "cricket", "passwords", 370, 8.5313814605163127, 0, 8.5313814605163127, 0, 0 },
+	{ "winter", "passwords", 152, 7.2479275134435852, 0, 7.2479275134435852, 0, 0 },
+	{ "skipper", "passwords", 614, 9.2620948453701786, 0, 9.2620948453701786, 0, 0 },
+	{ "alpha", "passwords", 515, 9.0084286220705803, 0, 9.0084286220705803, 0, 0 },
+	{ "charlie", "passwords", 38, 5.2479275134435852, 0, 5.2479275134435852, 0, 0 },
+	{ "paris", "passwords", 526, 9.0389189892923021, 0, 9.0389189892923021, 0, 0 },
+	{ "asdf", "passwords", 173, 7.4346282276367246, 0, 7.4346282276367246, 0, 0 },
+	{ "enter", "passwords", 141, 7.1395513523987937, 0, 7.1395513523987937, 0, 0 },
+	{ "dreamer", "passwords", 635, 9.310612781659529, 0, 9.310612781659529, 0, 0 },
+	{ "gators", "passwords", 230, 7.8454900509443748, 0, 7.8454900509443748, 0, 0 },
+	{ "bubba1", "passwords", 604, 9.2384047393250786, 0, 9.2384047393250786, 0, 0 },
+	{ "monday", "passwords", 531, 9.0525680508041528, 0, 9.0525680508041528, 0, 0 },
+	{ "xxxxxx", "passwords", 124, 6.9541963103868749, 0, 6.9541963103868749, 0, 0 },
+	{ "pepsi", "passwords", 751, 9.5526690975142721, 0, 9.5526690975142721, 0, 0 },
+	{ "member", "passwords", 274, 8.0980320829605272, 0, 8.0980320829605272, 0, 0 },
+	{ "biteme", "passwords", 56, 5.8073549220576037, 0, 5.8073549220576037, 0, 0 },
+	{ "hitman", "passwords", 578, 9.1749256825006782, 0, 9.1749256825006782, 0, 0 },
+	{ "bigred", "passwords", 569, 9.1522848423065817, 0, 9.1522848423065817, 0, 0 },
+	{ "remember", "english", 216, 7.7548875021634682, 0, 7.7548875021634682, 0, 0 },
+	{ "chevy", "passwords", 345, 8.4304525516655318, 0, 8.4304525516655318, 0, 0 },
+	{ "lizard", "passwords", 465, 8.8610869059953945, 0, 8.8610869059953945, 0, 0 },
+	{ "sugar", "passwords", 671, 9.3901689562001831, 0, 9.3901689562001831, 0, 0 },
+	{ "debbie", "female_names", 141, 7.1395513523987937, 0, 7.1395513523987937, 0, 0 },
+	{ "rolltide", "passwords", 615, 9.2644426002266016, 0, 9.2644426002266016, 0, 0 },
+	{ "natasha", "female_names", 307, 8.2620948453701786, 0, 8.2620948453701786, 0, 0 },
+	{ "merlin", "passwords", 68, 6.0874628412503391, 0, 6.0874628412503391, 0, 0 },
+	{ "blue", "passwords", 164, 7.3575520046180838, 0, 7.3575520046180838, 0, 0 },
+	{ "sterling", "male_names", 465, 8.8610869059953945, 0, 8.8610869059953945, 0, 0 },
+	{ "wolf", "passwords", 364, 8.5077946401986964, 0, 8.5077946401986964, 0, 0 },
+	{ "sexsex", "passwords", 170, 7.4093909361377017, 0, 7.4093909361377017, 0, 0 },
+	{ "popcorn", "passwords", 628, 9.2946207488916261, 0, 9.2946207488916261, 0, 0 },
+	{ "sunset", "passwords", 770, 9.5887146355822637, 0, 9.5887146355822637, 0, 0 },
+	{ "testtest", "passwords", 730, 9.5117526537673793, 0, 9.5117526537673793, 0, 0 },
+	{ "simple", "passwords", 459, 8.8423503434138073, 0, 8.8423503434138073, 0, 0 },
+	{ "pookie", "passwords", 224, 7.8073549220576037, 0, 7.8073549220576037, 0, 0 },
+	{ "semperfi", "passwords", 519, 9.0195907283578816, 0, 9.0195907283578816, 0, 0 },
+	{ "horse", "passwords", 494, 8.9483672315846778, 0, 8.9483672315846778, 0, 0 },
+	{ "houston", "surnames", 389, 8.6036263449861927, 0, 8.6036263449861927, 0, 0 },
+	{ "jackie", "female_names", 233, 7.8641861446542807, 0, 7.8641861446542807, 0, 0 },
+	{ "qazwsx", "passwords", 178, 7.4757334309663976, 0, 7.4757334309663976, 0, 0 },
+	{ "sandy", "female_names", 318, 8.3128829552843548, 0, 8.3128829552843548, 0, 0 },
+	{ "suck", "passwords", 710, 9.4716752143920449, 0, 9.4716752143920449, 0, 0 },
+	{ "taurus", "passwords", 716, 9.4838157772642564, 0, 9.4838157772642564, 0, 0 },
+	{ "pirate", "passwords", 518, 9.0168082876865547, 0, 9.0168082876865547, 0, 0 },
+	{ "bass", "surnames", 408, 8.6724253419714952, 0, 8.6724253419714952, 0, 0 },
+	{ "gordon", "surnames", 135, 7.0768155970508309, 0, 7.0768155970508309, 0, 0 },
+	{ "sparky", "passwords", 79, 6.3037807481771031, 0, 6.3037807481771031, 0, 0 },
+	{ "teens", "passwords", 374, 8.5468944598876373, 0, 8.5468944598876373, 0, 0 },
+	{ "raptor", "passwords", 689, 9.4283601727042914, 0, 9.4283601727042914, 0, 0 },
+	{ "stupid", "passwords", 250, 7.965784284662087, 0, 7.965784284662087, 0, 0 },
+	{ "success", "passwords", 249, 7.9600019320680806, 0, 7.9600019320680806, 0, 0 },
+	{ "shannon", "female_names", 123, 6.9425145053392399, 0, 6.9425145053392399, 0, 0 },
+	{ "matrix", "passwords", 82, 6.3575520046180838, 0, 6.3575520046180838, 0, 0 },
+	{ "perfect", "english", 462, 8.851749041416058, 0, 8.851749041416058, 0, 0 },
+	{ "kitty", "passwords", 390, 8.6073303137496104, 0, 8.6073303137496104, 0, 0 },
+	{ "jordan", "passwords", 20, 4.3219280948873626, 0, 4.3219280948873626, 0, 0 },
+	{ "amateur", "passwords", 481, 8.9098930837700419, 0, 8.9098930837700419, 0, 0 },
+	{ "metallic", "passwords", 246, 7.9425145053392399, 0, 7.9425145053392399, 0, 0 },
+	{ "super", "passwords", 337, 8.3966047811818587, 0, 8.3966047811818587, 0, 0 },
+	{ "dallas", "passwords", 50, 5.6438561897747244, 0, 5.6438561897747244, 0, 0 },
+	{ "rusty", "male_names", 535, 9.06339508128851, 0, 9.06339508128851, 0, 0 },
+	{ "music", "passwords", 427, 8.7380922596204904, 0, 8.7380922596204904, 0, 0 },
+	{ "hobbes", "passwords", 572, 9.1598713367783891, 0, 9.1598713367783891, 0, 0 },
+	{ "cunt", "passwords", 333, 8.3793783670712614, 0, 8.3793783670712614, 0, 0 },
+	{ "billybob", "passwords", 759, 9.5679560754154664, 0, 9.5679560754154664, 0, 0 },
+	{ "marley", "passwords", 536, 9.0660891904577721, 0, 9.0660891904577721, 0, 0 },
+	{ "fuckme", "passwords", 24, 4.5849625007211561, 0, 4.5849625007211561, 0, 0 },
+	{ "jimmy", "male_names", 97, 6.5999128421871278, 0, 6.5999128421871278, 0, 0 },
+	{ "godzilla", "passwords", 318, 8.3128829552843548, 0, 8.3128829552843548, 0, 0 },
+	{ "frankie", "male_names", 387, 8.5961897561444101, 0, 8.5961897561444101, 0, 0 },
+	{ "trucks", "passwords", 678, 9.4051414631363439, 0, 9.4051414631363439, 0, 0 },
+	{ "broncos", "passwords", 347, 8.4387918525782606, 0, 8.4387918525782606, 0, 0 },
+	{ "camaro", "passwords", 81, 6.3398500028846243, 0, 6.3398500028846243, 0, 0 },
+	{ "blonde", "passwords", 498, 8.9600019320680815, 0, 8.9600019320680815, 0, 0 },
+	{ "natalie", "female_names", 215, 7.7481928495894605, 0, 7.7481928495894605, 0, 0 },
+	{ "redskins", "passwords", 208, 7.7004397181410917, 0, 7.7004397181410917, 0, 0 },
+	{ "tits", "passwords", 237, 7.8887432488982592, 0, 7.8887432488982592, 0, 0 },
+	{ "hockey", "passwords", 37, 5.2094533656289501, 0, 5.2094533656289501, 0, 0 },
+	{ "eclipse", "passwords", 423, 8.7245138531199498, 0, 8.7245138531199498, 0, 0 },
+	{ "heka6w2", "passwords", 328, 8.3575520046180838, 0, 8.3575520046180838, 0, 0 },
+	{ "money", "passwords", 98, 6.6147098441152083, 0, 6.6147098441152083, 0, 0 },
+	{ "1qaz2wsx", "passwords", 503, 8.9744145898055265, 0, 8.9744145898055265, 0, 0 },
+	{ "extreme", "passwords", 475, 8.8917837032183105, 0, 8.8917837032183105, 0, 0 },
+	{ "gemini", "passwords", 238, 7.8948177633079437, 0, 7.8948177633079437, 0, 0 },
+	{ "clinton", "male_names", 222, 7.7944158663501062, 0, 7.7944158663501062, 0, 0 },
+	{ "boston", "passwords", 146, 7.1898245588800176, 0, 7.1898245588800176, 0, 0 },
+	{ "red123", "passwords", 290, 8.1799090900149345, 0, 8.1799090900149345, 0, 0 },
+	{ "tony", "male_names", 101, 6.6582114827517946, 0, 6.6582114827517946, 0, 0 },
+	{ "martin", "surnames", 15, 3.9068905956085187, 0, 3.9068905956085187, 0, 0 },
+	{ "lovers", "passwords", 218, 7.768184324776926, 0, 7.768184324776926, 0, 0 },
+	{ "babes", "passwords", 594, 9.2143191208007664, 0, 9.2143191208007664, 0, 0 },
+	{ "ireland", "passwords", 645, 9.3331553503106157, 0, 9.3331553503106157, 0, 0 },
+	{ "kitten", "passwords", 336, 8.3923174227787598, 0, 8.3923174227787598, 0, 0 },
+	{ "catch22", "passwords", 732, 9.5156998382840428, 0, 9.5156998382840428, 0, 0 },
+	{ "paul", "male_names", 13, 3.7004397181410922, 0, 3.7004397181410922, 0, 0 },
+	{ "goober", "passwords", 433, 8.7582232147267245, 0, 8.7582232147267245, 0, 0 },
+	{ "112233", "passwords", 217, 7.7615512324444795, 0, 7.7615512324444795, 0, 0 },
+	{ "dreams", "passwords", 376, 8.5545888516776376, 0, 8.5545888516776376, 0, 0 },
+	{ "brooke", "female_names", 388, 8.5999128421871269, 0, 8.5999128421871269, 0, 0 },
+	{ "tigers", "passwords", 90, 6.4918530963296748, 0, 6.4918530963296748, 0, 0 },
+	{ "voodoo", "passwords", 275, 8.1032878084120217, 0, 8.1032878084120217, 0, 0 },
+	{ "porsche", "passwords", 91, 6.5077946401986964, 0, 6.5077946401986964, 0, 0 },
+	{ "fucker", "passwords", 65, 6.0223678130284544, 0, 6.0223678130284544, 0, 0 },
+	{ "rachel", "female_names", 79, 6.3037807481771031, 0, 6.3037807481771031, 0, 0 },
+	{ "dragon", "passwords", 7, 2.8073549220576042, 0, 2.8073549220576042, 0, 0 },
+	{ "donkey", "passwords", 381, 8.5736471874933216, 0, 8.5736471874933216, 0, 0 },
+	{ "marcus", "male_names", 141, 7.1395513523987937, 0, 7.1395513523987937, 0, 0 },
+	{ "trooper", "passwords", 738, 9.5274770060603959, 0, 9.5274770060603959, 0, 0 },
+	{ "ncc1701", "passwords", 127, 6.9886846867721655, 0, 6.9886846867721655, 0, 0 },
+	{ "69696969", "passwords", 335, 8.3880172853451356, 0, 8.3880172853451356, 0, 0 },
+	{ "baseball", "passwords", 9, 3.1699250014423122, 0, 3.1699250014423122, 0, 0 },
+	{ "trinity", "passwords", 382, 8.5774288280357496, 0, 8.5774288280357496, 0, 0 },
+	{ "taylor", "surnames", 10, 3.3219280948873622, 0, 3.3219280948873622, 0, 0 },
+	{ "douglas", "male_names", 45, 5.4918530963296748, 0, 5.4918530963296748, 0, 0 },
+	{ "snake", "passwords", 664, 9.3750394313469254, 0, 9.3750394313469254, 0, 0 },
+	{ "king", "surnames", 29, 4.8579809951275719, 0, 4.8579809951275719, 0, 0 },
+	{ "legend", "passwords", 301, 8.2336196767597016, 0, 8.2336196767597016, 0, 0 },
+	{ "nascar", "passwords", 95, 6.5698556083309478, 0, 6.5698556083309478, 0, 0 },
+	{ "destiny", "passwords", 463, 8.8548683832602357, 0, 8.8548683832602357, 0, 0 },
+	{ "knight", "passwords", 117, 6.8703647195834048, 0, 6.8703647195834048, 0, 0 },
+	{ "cooper", "surnames", 60, 5.9068905956085187, 0, 5.9068905956085187, 0, 0 },
+	{ "cock", "passwords", 266, 8.0552824355011889, 0, 8.0552824355011889, 0, 0 },
+	{ "erotic", "passwords", 609, 9.2502984179063326, 0, 9.2502984179063326, 0, 0 },
+	{ "power", "passwords", 291, 8.184875342908283, 0, 8.184875342908283, 0, 0 },
+	{ "scorpion", "passwords", 299, 8.2240016741981048, 0, 8.2240016741981048, 0, 0 },
+	{ "horses", "passwords", 441, 8.7846348455575214, 0, 8.7846348455575214, 0, 0 },
+	{ "jasper", "passwords", 181, 7.4998458870832057, 0, 7.4998458870832057, 0, 0 },
+	{ "airborne", "passwords", 353, 8.4635243732711807, 0, 8.4635243732711807, 0, 0 },
+	{ "nipple", "passwords", 542, 9.0821490413538708, 0, 9.0821490413538708, 0, 0 },
+	{ "forest", "passwords", 537, 9.0687782779854125, 0, 9.0687782779854125, 0, 0 },
+	{ "ou812", "passwords", 302, 8.2384047393250786, 0, 8.2384047393250786, 0, 0 },
+	{ "boobies", "passwords", 447, 8.8041310211833181, 0, 8.8041310211833181, 0, 0 },
+	{ "domino", "passwords", 575, 9.1674181458317374, 0, 9.1674181458317374, 0, 0 },
+	{ "colorado", "passwords", 430, 8.7481928495894596, 0, 8.7481928495894596, 0, 0 },
+	{ "lickme", "passwords", 643, 9.3286749273279472, 0, 9.3286749273279472, 0, 0 },
+	{ "maverick", "passwords", 93, 6.539158811108031, 0, 6.539158811108031, 0, 0 },
+	{ "digital", "passwords", 383, 8.581200581924957, 0, 8.581200581924957, 0, 0 },
+	{ "ford", "surnames", 97, 6.5999128421871278, 0, 6.5999128421871278, 0, 0 },
+	{ "hendrix", "passwords", 703, 9.4573808790725344, 0, 9.4573808790725344, 0, 0 },
+	{ "lesbian", "passwords", 663, 9.3728650601125878, 0, 9.3728650601125878, 0, 0 },
+	{ "joshua", "male_names", 38, 5.2479275134435852, 0, 5.2479275134435852, 0, 0 },
+	{ "budlight", "passwords", 583, 9.187352073200497, 0, 9.187352073200497, 0, 0 },
+	{ "friday", "passwords", 434, 8.7615512324444786, 0, 8.7615512324444786, 0, 0 },
+	{ "stargate", "passwords", 586, 9.1947568544222484, 0, 9.1947568544222484, 0, 0 },
+	{ "prince", "passwords", 188, 7.5545888516776376, 0, 7.5545888516776376, 0, 0 },
+	{ "bill", "male_names", 154, 7.266786540694901, 0, 7.266786540694901, 0, 0 },
+	{ "elizabet", "passwords", 676, 9.4008794362821835, 0, 9.4008794362821835, 0, 0 },
+	{ "eagle1", "passwords", 339, 8.4051414631363439, 0, 8.4051414631363439, 0, 0 },
+	{ "death", "passwords", 421, 8.7176764230663952, 0, 8.7176764230663952, 0, 0 },
+	{ "wildcats", "passwords", 559, 9.1267044728431905, 0, 9.1267044728431905, 0, 0 },
+	{ "bigboy", "passwords", 315, 8.2992080183872794, 0, 8.2992080183872794, 0, 0 },
+	{ "chester", "passwords", 161, 7.3309168781146168, 0, 7.3309168781146168, 0, 0 },
+	{ "movie", "english", 695, 9.4408691676108702, 0, 9.4408691676108702, 0, 0 },
+	{ "travis", "male_names", 116, 6.8579809951275719, 0, 6.8579809951275719, 0, 0 },
+	{ "bigman", "passwords", 589, 9.2021238238304601, 0, 9.2021238238304601, 0, 0 },
+	{ "zombie", "passwords", 590, 9.2045711442492042, 0, 9.2045711442492042, 0, 0 },
+	{ "duke", "passwords", 592, 9.2094533656289492, 0, 9.2094533656289492, 0, 0 },
+	{ "beer", "passwords", 285, 8.1548181090521048, 0, 8.1548181090521048, 0, 0 },
+	{ "daniel", "male_names", 12, 3.5849625007211561, 0, 3.5849625007211561, 0, 0 },
+	{ "rush2112", "passwords", 284, 8.1497471195046813, 0, 8.1497471195046813, 0, 0 },
+	{ "eminem", "passwords", 509, 8.9915218460756954, 0, 8.9915218460756954, 0, 0 },
+	{ "charles", "male_names", 8, 3, 0, 3, 0, 0 },
+	{ "squirt", "passwords", 570, 9.1548181090521048, 0, 9.1548181090521048, 0, 0 },
+	{ "business", "english", 346, 8.4346282276367255, 0, 8.4346282276367255, 0, 0 },
+	{ "snowman", "passwords", 686, 9.422064766172813, 0, 9.422064766172813, 0, 0 },
+	{ "guitar", "passwords", 85, 6.4093909361377017, 0, 6.4093909361377017, 0, 0 },
+	{ "srinivas", "passwords", 706, 9.4635243732711807, 0, 9.4635243732711807, 0, 0 },
+	{ "lasvegas", "passwords", 418, 8.7073591320808834, 0, 8.7073591320808834, 0, 0 },
+	{ "buffalo", "passwords", 389, 8.6036263449861927, 0, 8.6036263449861927, 0, 0 },
+	{ "kramer", "surnames", 480, 8.9068905956085178, 0, 8.9068905956085178, 0, 0 },
+	{ "elephant", "passwords", 354, 8.4676055500829968, 0, 8.4676055500829968, 0, 0 },
+	{ "avalon", "passwords", 670, 9.3880172853451356, 0, 9.3880172853451356, 0, 0 },
+	{ "pontiac", "passwords", 640, 9.3219280948873617, 0, 9.3219280948873617, 0, 0 },
+	{ "packard", "passwords", 702, 9.4553272203045609, 0, 9.4553272203045609, 0, 0 },
+	{ "bigdick", "passwords", 132, 7.0443941193584534, 0, 7.0443941193584534, 0, 0 },
+	{ "oscar", "male_names", 146, 7.1898245588800176, 0, 7.1898245588800176, 0, 0 },
+	{ "copper", "passwords", 329, 8.3619437737352413, 0, 8.3619437737352413, 0, 0 },
+	{ "cookie", "passwords", 94, 6.5545888516776376, 0, 6.5545888516776376, 0, 0 },
+	{ "katana", "passwords", 746, 9.5430318202552371, 0, 9.5430318202552371, 0, 0 },
+	{ "rabbit", "passwords", 140, 7.1292830169449664, 0, 7.1292830169449664, 0, 0 },
+	{ "pyramid", "passwords", 744, 9.539158811108031, 0, 9.539158811108031, 0, 0 },
+	{ "chelsea", "passwords", 73, 6.1898245588800176, 0, 6.1898245588800176, 0, 0 },
+	{ "johnny", "male_names", 95, 6.5698556083309478, 0, 6.5698556083309478, 0, 0 },
+	{ "696969", "passwords", 13, 3.7004397181410922, 0, 3.7004397181410922, 0, 0 },
+	{ "madison", "passwords", 191, 7.5774288280357487, 0, 7.5774288280357487, 0, 0 },
+	{ "samsung", "passwords", 603, 9.2360141919000842, 0, 9.2360141919000842, 0, 0 },
+	{ "brandon", "male_names", 68, 6.0874628412503391, 0, 6.0874628412503391, 0, 0 },
+	{ "green", "surnames", 33, 5.0443941193584534, 0, 5.0443941193584534, 0, 0 },
+	{ "united", "passwords", 220, 7.7813597135246599, 0, 7.7813597135246599, 0, 0 },
+	{ "november", "passwords", 469, 8.8734441125153758, 0, 8.8734441125153758, 0, 0 },
+	{ "garfield", "passwords", 331, 8.3706874068072175, 0, 8.3706874068072175, 0, 0 },
+	{ "snickers", "passwords", 505, 8.9801395776391573, 0, 8.9801395776391573, 0, 0 },
+	{ "carrie", "female_names", 129, 7.011227255423254, 0, 7.011227255423254, 0, 0 },
+	{ "jack", "male_names", 53, 5.7279204545631988, 0, 5.7279204545631988, 0, 0 },
+	{ "mouse", "passwords", 631, 9.3014961949825494, 0, 9.3014961949825494, 0, 0 },
+	{ "football", "passwords", 10, 3.3219280948873622, 0, 3.3219280948873622, 0, 0 },
+	{ "malibu", "passwords", 800, 9.6438561897747253, 0, 9.6438561897747253, 0, 0 },
+	{ "yamaha", "passwords", 144, 7.1699250014423122, 0, 7.1699250014423122, 0, 0 },
+	{ "picard", "passwords", 549, 9.1006623390051988, 0, 9.1006623390051988, 0, 0 },
+	{ "cherokee", "passwords", 491, 8.9395792143146924, 0, 8.9395792143146924, 0, 0 },
+	{ "russell", "male_names", 81, 6.3398500028846243, 0, 6.3398500028846243, 0, 0 },
+	{ "pussies", "passwords", 444, 8.7944158663501053, 0, 8.7944158663501053, 0, 0 },
+	{ "looking", "english", 257, 8.0056245491938789, 0, 8.0056245491938789, 0, 0 },
+	{ "viper", "passwords", 312, 8.2854022188622487, 0, 8.2854022188622487, 0, 0 },
+	{ "sucker", "passwords", 401, 8.6474584264549197, 0, 8.6474584264549197, 0, 0 },
+	{ "david", "male_names", 6, 2.5849625007211561, 0, 2.5849625007211561, 0, 0 },
+	{ "access", "passwords", 44, 5.4594316186372973, 0, 5.4594316186372973, 0, 0 },
+	{ "lisa", "female_names", 11, 3.4594316186372973, 0, 3.4594316186372973, 0, 0 },
+	{ "robbie", "male_names", 462, 8.851749041416058, 0, 8.851749041416058, 0, 0 },
+	{ "matthew", "male_names", 25, 4.6438561897747244, 0, 4.6438561897747244, 0, 0 },
+	{ "barney", "passwords", 154, 7.266786540694901, 0, 7.266786540694901, 0, 0 },
+	{ "spiderma", "passwords", 646, 9.3353903546939243, 0, 9.3353903546939243, 0, 0 },
+	{ "wallace", "surnames", 101, 6.6582114827517946, 0, 6.6582114827517946, 0, 0 },
+	{ "beaver", "passwords", 292, 8.1898245588800176, 0, 8.1898245588800176, 0, 0 },
+	{ "mitchell", "surnames", 39, 5.2854022188622487, 0, 5.2854022188622487, 0, 0 },
+	{ "arsenal", "passwords", 177, 7.4676055500829976, 0, 7.4676055500829976, 0, 0 },
+	{ "lifehack", "passwords", 319, 8.3174126137648692, 0, 8.3174126137648692, 0, 0 },
+	{ "wolverin", "passwords", 567, 9.147204924942228, 0, 9.147204924942228, 0, 0 },
+	{ "black", "passwords", 114, 6.8328900141647413, 0, 6.8328900141647413, 0, 0 },
+	{ "norman", "male_names", 111, 6.7944158663501062, 0, 6.7944158663501062, 0, 0 },
+	{ "wanker", "passwords", 523, 9.030667136246942, 0, 9.030667136246942, 0, 0 },
+	{ "danger", "passwords", 772, 9.5924570372680797, 0, 9.5924570372680797, 0, 0 },
+	{ "peter", "male_names", 43, 5.4262647547020979, 0, 5.4262647547020979, 0, 0 },
+	{ "wildcat", "passwords", 673, 9.3944626946103167, 0, 9.3944626946103167, 0, 0 },
+	{ "blazer", "passwords", 304, 8.2479275134435852, 0, 8.2479275134435852, 0, 0 },
+	{ "liberty", "passwords", 610, 9.2526654324502484, 0, 9.2526654324502484, 0, 0 },
+	{ "wolfpack", "passwords", 679, 9.4072677642447324, 0, 9.4072677642447324, 0, 0 },
+	{ "reggie", "male_names", 540, 9.0768155970508317, 0, 9.0768155970508317, 0, 0 },
+	{ "candy", "female_names", 548, 9.0980320829605272, 0, 9.0980320829605272, 0, 0 },
+	{ "sticky", "passwords", 726, 9.5038257379957507, 0, 9.5038257379957507, 0, 0 },
+	{ "freepass", "passwords", 568, 9.1497471195046813, 0, 9.1497471195046813, 0, 0 },
+	{ "racing", "passwords", 371, 8.5352753766208025, 0, 8.5352753766208025, 0, 0 },
+	{ "232323", "passwords", 297, 8.2143191208007664, 0, 8.2143191208007664, 0, 0 },
+	{ "accord", "passwords", 627, 9.2923216328020395, 0, 9.2923216328020395, 0, 0 },
+	{ "redsox", "passwords", 171, 7.4178525148858983, 0, 7.4178525148858983, 0, 0 },
+	{ "apple", "passwords", 286, 8.1598713367783891, 0, 8.1598713367783891, 0, 0 },
+	{ "hercules", "passwords", 754, 9.5584207132686636, 0, 9.5584207132686636, 0, 0 },
+	{ "heaven", "passwords", 311, 8.2807707701306033, 0, 8.2807707701306033, 0, 0 },
+	{ "madmax", "passwords", 695, 9.4408691676108702, 0, 9.4408691676108702, 0, 0 },
+	{ "alpha1", "passwords", 737, 9.5255208090950703, 0, 9.5255208090950703, 0, 0 },
+	{ "winston", "passwords", 211, 7.7210991887071847, 0, 7.7210991887071847, 0, 0 },
+	{ "lovely", "passwords", 502, 8.971543553950772, 0, 8.971543553950772, 0, 0 },
+	{ "letmein", "passwords", 11, 3.4594316186372973, 0, 3.4594316186372973, 0, 0 },
+	{ "montana", "passwords", 426, 8.7347096202258374, 0, 8.7347096202258374, 0, 0 },
+	{ "richard", "male_names", 7, 2.8073549220576042, 0, 2.8073549220576042, 0, 0 },
+	{ "sunshine", "passwords", 40, 5.3219280948873626, 0, 5.3219280948873626, 0, 0 },
+	{ "viking", "passwords", 185, 7.5313814605163119, 0, 7.5313814605163119, 0, 0 },
+	{ "freddy", "passwords", 263, 8.0389189892923021, 0, 8.0389189892923021, 0, 0 },
+	{ "justice", "passwords", 571, 9.1573469353628436, 0, 9.1573469353628436, 0, 0 },
+	{ "patricia", "female_names", 2, 1, 0, 1, 0, 0 },
+	{ "braves", "passwords", 265, 8.0498485494505623, 0, 8.0498485494505623, 0, 0 },
+	{ "october", "passwords", 471, 8.879583249612784, 0, 8.879583249612784, 0, 0 },
+	{ "hawaii", "passwords", 439, 8.7780771295353581, 0, 8.7780771295353581, 0, 0 },
+	{ "forever", "passwords", 204, 7.6724253419714952, 0, 7.6724253419714952, 0, 0 },
+	{ "tattoo", "passwords", 713, 9.4777582664438889, 0, 9.4777582664438889, 0, 0 },
+	{ "swordfis", "passwords", 599, 9.2264121927887857, 0, 9.2264121927887857, 0, 0 },
+	{ "softball", "passwords", 548, 9.0980320829605272, 0, 9.0980320829605272, 0, 0 },
+	{ "scooter", "passwords", 87, 6.4429434958487279, 0, 6.4429434958487279, 0, 0 },
+	{ "guinness", "passwords", 386, 8.5924570372680797, 0, 8.5924570372680797, 0, 0 },
+	{ "zeppelin", "passwords", 773, 9.5943246039248482, 0, 9.5943246039248482, 0, 0 },
+	{ "iwantu", "passwords", 186, 7.539158811108031, 0, 7.539158811108031, 0, 0 },
+	{ "stanley", "male_names", 104, 6.7004397181410917, 0, 6.7004397181410917, 0, 0 },
+	{ "williams", "surnames", 3, 1.5849625007211561, 0, 1.5849625007211561, 0, 0 },
+	{ "wrangler", "passwords", 785, 9.6165488437789897, 0, 9.6165488437789897, 0, 0 },
+	{ "house", "english", 249, 7.9600019320680806, 0, 7.9600019320680806, 0, 0 },
+	{ "hunting", "passwords", 600, 9.2288186904958813, 0, 9.2288186904958813, 0, 0 },
+	{ "kermit", "male_names", 501, 8.968666793195208, 0, 8.968666793195208, 0, 0 },
+	{ "light", "english", 653, 9.3509391815464316, 0, 9.3509391815464316, 0, 0 },
+	{ "frank", "male_names", 31, 4.9541963103868749, 0, 4.9541963103868749, 0, 0 },
+	{ "jasmine", "passwords", 196, 7.6147098441152083, 0, 7.6147098441152083, 0, 0 },
+	{ "samson", "passwords", 277, 8.1137421660491889, 0, 8.1137421660491889, 0, 0 },
+	{ "shit", "passwords", 355, 8.4716752143920449, 0, 8.4716752143920449, 0, 0 },
+	{ "jordan23", "passwords", 338, 8.4008794362821835, 0, 8.4008794362821835, 0, 0 },
+	{ "flower", "passwords", 203, 7.6653359171851765, 0, 7.6653359171851765, 0, 0 },
+	{ "lacrosse", "passwords", 478, 8.9008668079807478, 0, 8.9008668079807478, 0, 0 },
+	{ "lover", "passwords", 239, 7.9008668079807487, 0, 7.9008668079807487, 0, 0 },
+	{ "princess", "passwords", 72, 6.1699250014423122, 0, 6.1699250014423122, 0, 0 },
+	{ "cannon", "surnames", 339, 8.4051414631363439, 0, 8.4051414631363439, 0, 0 },
+	{ "goblue", "passwords", 648, 9.3398500028846243, 0, 9.3398500028846243, 0, 0 },
+	{ "159753", "passwords", 736, 9.5235619560570122, 0, 9.5235619560570122, 0, 0 },
+	{ "111111", "passwords", 18, 4.1699250014423122, 0, 4.1699250014423122, 0, 0 },
+	{ "badboy", "passwords", 157, 7.294620748891627, 0, 7.294620748891627, 0, 0 },
+	{ "alaska", "passwords", 482, 8.912889336229961, 0, 8.912889336229961, 0, 0 },
+	{ "champion", "passwords", 545, 9.0901124196642886, 0, 9.0901124196642886, 0, 0 },
+	{ "simpsons", "passwords", 698, 9.4470832262096529, 0, 9.4470832262096529, 0, 0 },
+	{ "austin", "passwords", 66, 6.0443941193584534, 0, 6.0443941193584534, 0, 0 },
+	{ "8675309", "passwords", 227, 7.826548487290915, 0, 7.826548487290915, 0, 0 },
+	{ "morgan", "surnames", 55, 5.7813597135246599, 0, 5.7813597135246599, 0, 0 },
+	{ "2112", "passwords", 267, 8.0606959316875546, 0, 8.0606959316875546, 0, 0 },
+	{ "jenny", "female_names", 278, 8.1189410727235067, 0, 8.1189410727235067, 0, 0 },
+	{ "speedy", "passwords", 388, 8.5999128421871269, 0, 8.5999128421871269, 0, 0 },
+	{ "benjamin", "male_names", 66, 6.0443941193584534, 0, 6.0443941193584534, 0, 0 },
+	{ "nirvana", "passwords", 394, 8.6220518194563756, 0, 8.6220518194563756, 0, 0 },
+	{ "rocky", "male_names", 457, 8.8360503550580702, 0, 8.8360503550580702, 0, 0 },
+	{ "pass", "passwords", 35, 5.1292830169449664, 0, 5.1292830169449664, 0, 0 },
+	{ "steve", "male_names", 74, 6.2094533656289501, 0, 6.2094533656289501, 0, 0 },
+	{ "celtic", "passwords", 405, 8.6617780977719878, 0, 8.6617780977719878, 0, 0 },
+	{ "player", "passwords", 126, 6.9772799234999168, 0, 6.9772799234999168, 0, 0 },
+	{ "angels", "passwords", 187, 7.5468944598876364, 0, 7.5468944598876364, 0, 0 },
+	{ "vagina", "passwords", 489, 8.9336906549522332, 0, 8.9336906549522332, 0, 0 },
+	{ "cumming", "passwords", 644, 9.3309168781146177, 0, 9.3309168781146177, 0, 0 },
+	{ "lincoln", "male_names", 648, 9.3398500028846243, 0, 9.3398500028846243, 0, 0 },
+	{ "explorer", "passwords", 360, 8.4918530963296739, 0, 8.4918530963296739, 0, 0 },
+	{ "mature", "passwords", 731, 9.513727595952437, 0, 9.513727595952437, 0, 0 },
+	{ "police", "passwords", 361, 8.4958550268871704, 0, 8.4958550268871704, 0, 0 },
+	{ "driver", "passwords", 221, 7.7879025593914317, 0, 7.7879025593914317, 0, 0 },
+	{ "alicia", "female_names", 152, 7.2479275134435852, 0, 7.2479275134435852, 0, 0 },
+	{ "thunder", "passwords", 60, 5.9068905956085187, 0, 5.9068905956085187, 0, 0 },
+	{ "buddy", "passwords", 258, 8.011227255423254, 0, 8.011227255423254, 0, 0 },
+	{ "james", "male_names", 1, 0, 0, 0, 0, 0 },
+	{ "muffin", "passwords", 205, 7.6794800995054464, 0, 7.6794800995054464, 0, 0 },
+	{ "1234", "passwords", 4, 2, 0, 2, 0, 0 },
+	{ "fantasy", "passwords", 404, 8.6582114827517955, 0, 8.6582114827517955, 0, 0 },
+	{ "teresa", "female_names", 54, 5.7548875021634682, 0, 5.7548875021634682, 0, 0 },
+	{ "fluffy", "passwords", 440, 8.7813597135246599, 0, 8.7813597135246599, 0, 0 },
+	{ "242424", "passwords", 621, 9.2784494582204822, 0, 9.2784494582204822, 0, 0 },
+	{ "integra", "passwords", 784, 9.6147098441152075, 0, 9.6147098441152075, 0, 0 },
+	{ "brazil", "passwords", 497, 8.9571020415622868, 0, 8.9571020415622868, 0, 0 },
+	{ "1212", "passwords", 268, 8.0660891904577721, 0, 8.0660891904577721, 0, 0 },
+	{ "michele", "female_names", 154, 7.266786540694901, 0, 7.266786540694901, 0, 0 },
+	{ "jeremy", "male_names", 76, 6.2479275134435852, 0, 6.2479275134435852, 0, 0 },
+	{ "mother", "passwords", 179, 7.4838157772642564, 0, 7.4838157772642564, 0, 0 },
+	{ "mine", "english", 450, 8.8137811912170374, 0, 8.8137811912170374, 0, 0 },
+	{ "security", "passwords", 556, 9.1189410727235067, 0, 9.1189410727235067, 0, 0 },
+	{ "honda", "passwords", 451, 8.8169836232553802, 0, 8.8169836232553802, 0, 0 },
+	{ "nicholas", "male_names", 64, 6, 0, 6, 0, 0 },
+	{ "123321", "passwords", 344, 8.4262647547020979, 0, 8.4262647547020979, 0, 0 },
+	{ "soccer", "passwords", 31, 4.9541963103868749, 0, 4.9541963103868749, 0, 0 },
+	{ "baxter", "surnames", 499, 8.9628960053372602, 0, 8.9628960053372602, 0, 0 },
+	{ "bubbles", "passwords", 438, 8.7747870596011737, 0, 8.7747870596011737, 0, 0 },
+	{ "bulldog", "passwords", 123, 6.9425145053392399, 0, 6.9425145053392399, 0, 0 },
+	{ "mozart", "passwords", 487, 8.9277779620823416, 0, 8.9277779620823416, 0, 0 },
+	{ "mountain", "passwords", 219, 7.7747870596011737, 0, 7.7747870596011737, 0, 0 },
+	{ "wolves", "passwords", 718, 9.4878400338230513, 0, 9.4878400338230513, 0, 0 },
+	{ "electric", "passwords", 584, 9.1898245588800176, 0, 9.1898245588800176, 0, 0 },
+	{ "blowjob", "passwords", 135, 7.0768155970508309, 0, 7.0768155970508309, 0, 0 },
+	{ "121212", "passwords", 69, 6.1085244567781691, 0, 6.1085244567781691, 0, 0 },
+	{ "rose", "female_names", 65, 6.0223678130284544, 0, 6.0223678130284544, 0, 0 },
+	{ "pickle", "passwords", 760, 9.5698556083309487, 0, 9.5698556083309487, 0, 0 },
+	{ "silver", "passwords", 49, 5.6147098441152083, 0, 5.6147098441152083, 0, 0 },
+	{ "sports", "passwords", 696, 9.4429434958487288, 0, 9.4429434958487288, 0, 0 },
+	{ "131313", "passwords", 97, 6.5999128421871278, 0, 6.5999128421871278, 0, 0 },
+	{ "fender", "passwords", 143, 7.1598713367783891, 0, 7.1598713367783891, 0, 0 },
+	{ "hotmail", "passwords", 479, 8.9038818457361799, 0, 8.9038818457361799, 0, 0 },
+	{ "teen", "passwords", 665, 9.3772105303885525, 0, 9.3772105303885525, 0, 0 },
+	{ "gunner", "passwords", 261, 8.0279059965698849, 0, 8.0279059965698849, 0, 0 },
+	{ "storm", "passwords", 799, 9.6420516929279767, 0, 9.6420516929279767, 0, 0 },
+	{ "superman", "passwords", 21, 4.3923174227787607, 0, 4.3923174227787607, 0, 0 },
+	{ "redrum", "passwords", 521, 9.0251395622785076, 0, 9.0251395622785076, 0, 0 },
+	{ "darkstar", "passwords", 777, 9.6017707884077108, 0, 9.6017707884077108, 0, 0 },
+	{ "liverpoo", "passwords", 202, 7.6582114827517946, 0, 7.6582114827517946, 0, 0 },
+	{ "ping", "passwords", 776, 9.5999128421871269, 0, 9.5999128421871269, 0, 0 },
+	{ "789456", "passwords", 697, 9.4450148458684229, 0, 9.4450148458684229, 0, 0 },
+	{ "penguin", "passwords", 535, 9.06339508128851, 0, 9.06339508128851, 0, 0 },
+	{ "action", "passwords", 356, 8.4757334309663985, 0, 8.4757334309663985, 0, 0 },
+	{ "cheese", "passwords", 71, 6.1497471195046822, 0, 6.1497471195046822, 0, 0 },
+	{ "bear", "passwords", 228, 7.8328900141647413, 0, 7.8328900141647413, 0, 0 },
+	{ "1313", "passwords", 359, 8.4878400338230513, 0, 8.4878400338230513, 0, 0 },
+	{ "5150", "passwords", 231, 7.8517490414160571, 0, 7.8517490414160571, 0, 0 },
+	{ "zxcvbn", "passwords", 115, 6.8454900509443748, 0, 6.8454900509443748, 0, 0 },
+	{ "ducati", "passwords", 525, 9.0361736125534851, 0, 9.0361736125534851, 0, 0 },
+	{ "simone", "female_names", 676, 9.4008794362821835, 0, 9.4008794362821835, 0, 0 },
+	{ "pantera", "passwords", 530, 9.0498485494505623, 0, 9.0498485494505623, 0, 0 },
+	{ "hahaha", "passwords", 701, 9.4532706340106234, 0, 9.4532706340106234, 0, 0 },
+	{ "chronic", "passwords", 700, 9.451211111832329, 0, 9.451211111832329, 0, 0 },
+	{ "magic", "passwords", 257, 8.0056245491938789, 0, 8.0056245491938789, 0, 0 },
+	{ "bullshit", "passwords", 346, 8.4346282276367255, 0, 8.4346282276367255, 0, 0 },
+	{ "panthers", "passwords", 719, 9.4898479604392971, 0, 9.4898479604392971, 0, 0 },
+	{ "andrea", "female_names", 81, 6.3398500028846243, 0, 6.3398500028846243, 0, 0 },
+	{ "cool", "passwords", 324, 8.3398500028846243, 0, 8.3398500028846243, 0, 0 },
+	{ "albert", "male_names", 54, 5.7548875021634682, 0, 5.7548875021634682, 0, 0 },
+	{ "connor", "passwords", 641, 9.3241805466187415, 0, 9.3241805466187415, 0, 0 },
+	{ "mickey", "passwords", 92, 6.5235619560570131, 0, 6.5235619560570131, 0, 0 },
+	{ "woody", "passwords", 684, 9.4178525148858974, 0, 9.4178525148858974, 0, 0 },
+	{ "bigdog", "passwords", 76, 6.2479275134435852, 0, 6.2479275134435852, 0, 0 },
+	{ "carlos", "male_names", 80, 6.3219280948873626, 0, 6.3219280948873626, 0, 0 },
+	{ "doggie", "passwords", 300, 8.2288186904958813, 0, 8.2288186904958813, 0, 0 },
+	{ "angel", "male_names", 196, 7.6147098441152083, 0, 7.6147098441152083, 0, 0 },
+	{ "computer", "passwords", 58, 5.8579809951275719, 0, 5.8579809951275719, 0, 0 },
+	{ "andrew", "male_names", 35, 5.1292830169449664, 0, 5.1292830169449664, 0, 0 },
+	{ "bigdaddy", "passwords", 160, 7.3219280948873626, 0, 7.3219280948873626, 0, 0 },
+	{ "cardinal", "passwords", 652, 9.3487281542310772, 0, 9.3487281542310772, 0, 0 },
+	{ "sydney", "passwords", 289, 8.1749256825006782, 0, 8.1749256825006782, 0, 0 },
+	{ "daddy", "english", 556, 9.1189410727235067, 0, 9.1189410727235067, 0, 0 },
+	{ "tanner", "surnames", 563, 9.1369911120802296, 0, 9.1369911120802296, 0, 0 },
+	{ "simpson", "surnames", 120, 6.9068905956085187, 0, 6.9068905956085187, 0, 0 },
+	{ "hentai", "passwords", 378, 8.562242424221072, 0, 8.562242424221072, 0, 0 },
+	{ "tickle", "passwords", 756, 9.562242424221072, 0, 9.562242424221072, 0, 0 },
+	{ "qwerty", "passwords", 5, 2.3219280948873622, 0, 2.3219280948873622, 0, 0 },
+	{ "qwe123", "passwords", 779, 9.605479518061669, 0, 9.605479518061669, 0, 0 },
+	{ "carmen", "female_names", 111, 6.7944158663501062, 0, 6.7944158663501062, 0, 0 },
+	{ "suzuki", "passwords", 511, 8.9971794809376213, 0, 8.9971794809376213, 0, 0 },
+	{ "pamela", "female_names", 37, 5.2094533656289501, 0, 5.2094533656289501, 0, 0 },
+	{ "marlboro", "passwords", 174, 7.4429434958487279, 0, 7.4429434958487279, 0, 0 },
+	{ "butter", "passwords", 197, 7.6220518194563764, 0, 7.6220518194563764, 0, 0 },
+	{ "gabriel", "male_names", 208, 7.7004397181410917, 0, 7.7004397181410917, 0, 0 },
+	{ "123qwe", "passwords", 468, 8.8703647195834048, 0, 8.8703647195834048, 0, 0 },
+	{ "head", "english", 333, 8.3793783670712614, 0, 8.3793783670712614, 0, 0 },
+	{ "rocket", "passwords", 200, 7.6438561897747244, 0, 7.6438561897747244, 0, 0 },
+	{ "eric", "male_names", 33, 5.0443941193584534, 0, 5.0443941193584534, 0, 0 },
+	{ "parker", "surnames", 45, 5.4918530963296748, 0, 5.4918530963296748, 0, 0 },
+	{ "leslie", "female_names", 143, 7.1598713367783891, 0, 7.1598713367783891, 0, 0 },
+	{ "kawasaki", "passwords", 656, 9.3575520046180838, 0, 9.3575520046180838, 0, 0 },
+	{ "mercedes", "passwords", 142, 7.1497471195046822, 0, 7.1497471195046822, 0, 0 },
+	{ "pepper", "passwords", 43, 5.4262647547020979, 0, 5.4262647547020979, 0, 0 },
+	{ "master", "passwords", 17, 4.0874628412503391, 0, 4.0874628412503391, 0, 0 },
+	{ "sharon", "female_names", 20, 4.3219280948873626, 0, 4.3219280948873626, 0, 0 },
+	{ "gibson", "surnames", 110, 6.7813597135246599, 0, 6.7813597135246599, 0, 0 },
+	{ "midnight", "passwords", 163, 7.3487281542310772, 0, 7.3487281542310772, 0, 0 },
+	{ "johnson", "surnames", 2, 1, 0, 1, 0, 0 },
+	{ "theman", "passwords", 201, 7.651051691178929, 0, 7.651051691178929, 0, 0 },
+	{ "horny", "passwords", 99, 6.6293566200796095, 0, 6.6293566200796095, 0, 0 },
+	{ "newyork", "passwords", 214, 7.7414669864011474, 0, 7.7414669864011474, 0, 0 },
+	{ "nemesis", "passwords", 639, 9.3196721209469953, 0, 9.3196721209469953, 0, 0 },
+	{ "skippy", "passwords", 288, 8.1699250014423122, 0, 8.1699250014423122, 0, 0 },
+	{ "cartman", "passwords", 385, 8.5887146355822637, 0, 8.5887146355822637, 0, 0 },
+	{ "timothy", "male_names", 27, 4.7548875021634682, 0, 4.7548875021634682, 0, 0 },
+	{ "tiffany", "female_names", 110, 6.7813597135246599, 0, 6.7813597135246599, 0, 0 },
+	{ "buster", "passwords", 29, 4.8579809951275719, 0, 4.8579809951275719, 0, 0 },
+	{ "startrek", "passwords", 193, 7.5924570372680806, 0, 7.5924570372680806, 0, 0 },
+	{ "cowboy", "passwords", 80, 6.3219280948873626, 0, 6.3219280948873626, 0, 0 },
+	{ "reddog", "passwords", 412, 8.6865005271832185, 0, 8.6865005271832185, 0, 0 },
+	{ "bigcock", "passwords", 417, 8.7039035734446628, 0, 8.7039035734446628, 0, 0 },
+	{ "cherry", "passwords", 406, 8.6653359171851765, 0, 8.6653359171851765, 0, 0 },
+	{ "stars", "passwords", 694, 9.4387918525782606, 0, 9.4387918525782606, 0, 0 },
+	{ "jaguar", "passwords", 235, 7.8765169465649993, 0, 7.8765169465649993, 0, 0 },
+	{ "purple", "passwords", 86, 6.4262647547020979, 0, 6.4262647547020979, 0, 0 },
+	{ "sluts", "passwords", 585, 9.1922928144707665, 0, 9.1922928144707665, 0, 0 },
+	{ "babydoll", "passwords", 803, 9.649256177517314, 0, 9.649256177517314, 0, 0 },
+	{ "hummer", "passwords", 513, 9.0028150156070534, 0, 9.0028150156070534, 0, 0 },
+	{ "christin", "passwords", 362, 8.4998458870832057, 0, 8.4998458870832057, 0, 0 },
+	{ "vanessa", "female_names", 194, 7.5999128421871278, 0, 7.5999128421871278, 0, 0 },
+	{ "ferrari", "passwords", 116, 6.8579809951275719, 0, 6.8579809951275719, 0, 0 },
+	{ "eatme", "passwords", 642, 9.3264294871223026, 0, 9.3264294871223026, 0, 0 },
+	{ "samuel", "male_names", 60, 5.9068905956085187, 0, 5.9068905956085187, 0, 0 },
+	{ "porn", "passwords", 156, 7.2854022188622487, 0, 7.2854022188622487, 0, 0 },
+	{ "caroline", "female_names", 246, 7.9425145053392399, 0, 7.9425145053392399, 0, 0 },
+	{ "blowme", "passwords", 158, 7.3037807481771031, 0, 7.3037807481771031, 0, 0 },
+	{ "casino", "passwords", 781, 9.6091787381419795, 0, 9.6091787381419795, 0, 0 },
+	{ "cowboys", "passwords", 110, 6.7813597135246599, 0, 6.7813597135246599, 0, 0 },
+	{ "spitfire", "passwords", 490, 8.936637939002571, 0, 8.936637939002571, 0, 0 },
+	{ "killer", "passwords", 36, 5.1699250014423122, 0, 5.1699250014423122, 0, 0 },
+	{ "bunny", "passwords", 630, 9.2992080183872794, 0, 9.2992080183872794, 0, 0 },
+	{ "slayer", "passwords", 168, 7.3923174227787607, 0, 7.3923174227787607, 0, 0 },
+	{ "tinker", "passwords", 748, 9.5468944598876373, 0, 9.5468944598876373, 0, 0 },
+	{ "warrior", "passwords", 252, 7.9772799234999168, 0, 7.9772799234999168, 0, 0 },
+	{ "fishing", "passwords", 165, 7.366322214245816, 0, 7.366322214245816, 0, 0 },
+	{ "poopoo", "passwords", 626, 9.2900188469326181, 0, 9.2900188469326181, 0, 0 },
+	{ "654321", "passwords", 46, 5.5235619560570131, 0, 5.5235619560570131, 0, 0 },
+	{ "horney", "passwords", 348, 8.4429434958487288, 0, 8.4429434958487288, 0, 0 },
+	{ "casper", "passwords", 215, 7.7481928495894605, 0, 7.7481928495894605, 0, 0 },
+	{ "porno", "passwords", 283, 8.1446582428318823, 0, 8.1446582428318823, 0, 0 },
+	{ "spanky", "passwords", 159, 7.3128829552843557, 0, 7.3128829552843557, 0, 0 },
+	{ "devils", "passwords", 649, 9.3420746679991389, 0, 9.3420746679991389, 0, 0 },
+	{ "rangers", "passwords", 150, 7.2288186904958804, 0, 7.2288186904958804, 0, 0 },
+	{ "azerty", "passwords", 452, 8.8201789624151878, 0, 8.8201789624151878, 0, 0 },
+	{ "psycho", "passwords", 638, 9.3174126137648692, 0, 9.3174126137648692, 0, 0 },
+	{ "badass", "passwords", 462, 8.851749041416058, 0, 8.851749041416058, 0, 0 },
+	{ "louise", "female_names", 83, 6.3750394313469245, 0, 6.3750394313469245, 0, 0 },
+	{ "bang", "passwords", 753, 9.556506054671928, 0, 9.556506054671928, 0, 0 },
+	{ "bambam", "passwords", 683, 9.4157417682900899, 0, 9.4157417682900899, 0, 0 },
+	{ "steelers", "passwords", 102, 6.6724253419714952, 0, 6.6724253419714952, 0, 0 },
+	{ "winner", "passwords", 182, 7.5077946401986964, 0, 7.5077946401986964, 0, 0 },
+	{ "tarheels", "passwords", 727, 9.5058115539195942, 0, 9.5058115539195942, 0, 0 },
+	{ "long", "surnames", 82, 6.3575520046180838, 0, 6.3575520046180838, 0, 0 },
+	{ "antonio", "male_names", 98, 6.6147098441152083, 0, 6.6147098441152083, 0, 0 },
+	{ "surfer", "passwords", 349, 8.4470832262096529, 0, 8.4470832262096529, 0, 0 },
+	{ "playboy", "passwords", 397, 8.6329951971429573, 0, 8.6329951971429573, 0, 0 },
+	{ "007007", "passwords", 632, 9.3037807481771022, 0, 9.3037807481771022, 0, 0 },
+	{ "2323", "passwords", 791, 9.6275338844727916, 0, 9.6275338844727916, 0, 0 },
+	{ "chicks", "passwords", 688, 9.4262647547020979, 0, 9.4262647547020979, 0, 0 },
+	{ "brittany", "female_names", 186, 7.539158811108031, 0, 7.539158811108031, 0, 0 },
+	{ "cream", "passwords", 538, 9.0714623625566233, 0, 9.0714623625566233, 0, 0 },
+	{ "starwars", "passwords", 48, 5.5849625007211561, 0, 5.5849625007211561, 0, 0 },
+	{ "darkside", "passwords", 767, 9.5830827675029333, 0, 9.5830827675029333, 0, 0 },
+	{ "nigger", "passwords", 735, 9.521600439723727, 0, 9.521600439723727, 0, 0 },
+	{ "barbara", "female_names", 4, 2, 0, 2, 0, 0 },
+	{ "yellow", "passwords", 75, 6.2288186904958804, 0, 6.2288186904958804, 0, 0 },
+	{ "canada", "passwords", 242, 7.9188632372745946, 0, 7.9188632372745946, 0, 0 },
+	{ "russia", "passwords", 728, 9.5077946401986964, 0, 9.5077946401986964, 0, 0 },
+	{ "baby", "english", 227, 7.826548487290915, 0, 7.826548487290915, 0, 0 },
+	{ "packers", "passwords", 213, 7.7347096202258383, 0, 7.7347096202258383, 0, 0 },
+	{ "ranger", "passwords", 28, 4.8073549220576037, 0, 4.8073549220576037, 0, 0 },
+	{ "veronica", "female_names", 158, 7.3037807481771031, 0, 7.3037807481771031, 0, 0 },
+	{ "galore", "passwords", 618, 9.2714630279043746, 0, 9.2714630279043746, 0, 0 },
+	{ "fire", "passwords", 279, 8.1241213118291871, 0, 8.1241213118291871, 0, 0 },
+	{ "snowball", "passwords", 399, 8.640244936222345, 0, 8.640244936222345, 0, 0 },
+	{ "jackson", "surnames", 12, 3.5849625007211561, 0, 3.5849625007211561, 0, 0 },
+	{ "newport", "passwords", 613, 9.2597432636907815, 0, 9.2597432636907815, 0, 0 },
+	{ "12345", "passwords", 6, 2.5849625007211561, 0, 2.5849625007211561, 0, 0 },
+	{ "howard", "surnames", 63, 5.9772799234999168, 0, 5.9772799234999168, 0, 0 },
+	{ "shaved", "passwords", 685, 9.419960177847889, 0, 9.419960177847889, 0, 0 },
+	{ "joseph", "male_names", 9, 3.1699250014423122, 0, 3.1699250014423122, 0, 0 },
+	{ "westside", "passwords", 510, 8.9943534368588587, 0, 8.9943534368588587, 0, 0 },
+	{ "george", "male_names", 16, 4, 0, 4, 0, 0 },
+	{ "stephen", "male_names", 34, 5.0874628412503391, 0, 5.0874628412503391, 0, 0 },
+	{ "smokey", "passwords", 107, 6.7414669864011474, 0, 6.7414669864011474, 0, 0 },
+	{ "falcon", "passwords", 83, 6.3750394313469245, 0, 6.3750394313469245, 0, 0 },
+	{ "pimp", "passwords", 560, 9.1292830169449672, 0, 9.1292830169449672, 0, 0 },
+	{ "swimming", "passwords", 591, 9.2070143201775316, 0, 9.2070143201775316, 0, 0 },
+	{ "blink182", "passwords", 601, 9.2312211807111861, 0, 9.2312211807111861, 0, 0 },
+	{ "titanic", "passwords", 633, 9.3060616894283417, 0, 9.3060616894283417, 0, 0 },
+	{ "12345678", "passwords", 3, 1.5849625007211561, 0, 1.5849625007211561, 0, 0 },
+	{ "school", "english", 342, 8.4178525148858974, 0, 8.4178525148858974, 0, 0 },
+	{ "test", "passwords", 34, 5.0874628412503391, 0, 5.0874628412503391, 0, 0 },
+	{ "voyager", "passwords", 282, 8.1395513523987937, 0, 8.1395513523987937, 0, 0 },
+	{ "hooker", "passwords", 661, 9.3685064615076925, 0, 9.3685064615076925, 0, 0 },
+	{ "phpbb", "passwords", 658, 9.3619437737352413, 0, 9.3619437737352413, 0, 0 },
+	{ "family", "english", 246, 7.9425145053392399, 0, 7.9425145053392399, 0, 0 },
+	{ "lights", "passwords", 699, 9.4491486453754359, 0, 9.4491486453754359, 0, 0 },
+	{ "raider", "passwords", 496, 8.9541963103868749, 0, 8.9541963103868749, 0, 0 },
+	{ "claire", "female_names", 296, 8.2094533656289492, 0, 8.2094533656289492, 0, 0 },
+	{ "melissa", "female_names", 30, 4.9068905956085187, 0, 4.9068905956085187, 0, 0 },
+	{ "bastard", "passwords", 473, 8.8856963733393943, 0, 8.8856963733393943, 0, 0 },
+	{ "harry", "male_names", 70, 6.1292830169449664, 0, 6.1292830169449664, 0, 0 },
+	{ "juice", "passwords", 733, 9.517669388133811, 0, 9.517669388133811, 0, 0 },
+	{ "weed", "passwords", 801, 9.6456584324087107, 0, 9.6456584324087107, 0, 0 },
+	{ "coffee", "passwords", 120, 6.9068905956085187, 0, 6.9068905956085187, 0, 0 },
+	{ "vegeta", "passwords", 745, 9.5410966153495238, 0, 9.5410966153495238, 0, 0 },
+	{ "disney", "passwords", 596, 9.2191685204621621, 0, 9.2191685204621621, 0, 0 },
+	{ "jesus", "male_names", 125, 6.965784284662087, 0, 6.965784284662087, 0, 0 },
+	{ "pearljam", "passwords", 573, 9.1623913287569057, 0, 9.1623913287569057, 0, 0 },
+	{ "101010", "passwords", 474, 8.8887432488982583, 0, 8.8887432488982583, 0, 0 },
+	{ "billy", "male_names", 73, 6.1898245588800176, 0, 6.1898245588800176, 0, 0 },
+	{ "slut", "passwords", 334, 8.3837042924740519, 0, 8.3837042924740519, 0, 0 },
+	{ "1q2w3e4r", "passwords", 424, 8.7279204545631988, 0, 8.7279204545631988, 0, 0 },
+	{ "michelle", "female_names", 21, 4.3923174227787607, 0, 4.3923174227787607, 0, 0 },
+	{ "dickhead", "passwords", 368, 8.5235619560570122, 0, 8.5235619560570122, 0, 0 },
+	{ "nelson", "surnames", 37, 5.2094533656289501, 0, 5.2094533656289501, 0, 0 },
+	{ "patriots", "passwords", 647, 9.3376219019925077, 0, 9.3376219019925077, 0, 0 },
+	{ "lucky1", "passwords", 553, 9.1111356702347077, 0, 9.1111356702347077, 0, 0 },
+	{ "tennis", "passwords", 134, 7.0660891904577721, 0, 7.0660891904577721, 0, 0 },
+	{ "maxwell", "passwords", 226, 7.8201789624151878, 0, 7.8201789624151878, 0, 0 },
+	{ "friend", "english", 279, 8.1241213118291871, 0, 8.1241213118291871, 0, 0 },
+	{ "classic", "passwords", 624, 9.2854022188622487, 0, 9.2854022188622487, 0, 0 },
+	{ "rebecca", "female_names", 34, 5.0874628412503391, 0, 5.0874628412503391, 0, 0 },
+	{ "hunter", "passwords", 25, 4.6438561897747244, 0, 4.6438561897747244, 0, 0 },
+	{ "time", "english", 75, 6.2288186904958804, 0, 6.2288186904958804, 0, 0 },
+	{ "water", "english", 573, 9.1623913287569057, 0, 9.1623913287569057, 0, 0 },
+	{ "tomcat", "passwords", 251, 7.971543553950772, 0, 7.971543553950772, 0, 0 },
+	{ "212121", "passwords", 539, 9.0741414627525057, 0, 9.0741414627525057, 0, 0 },
+	{ "anderson", "surnames", 11, 3.4594316186372973, 0, 3.4594316186372973, 0, 0 },
+	{ "asdfghjk", "passwords", 446, 8.8008998999203047, 0, 8.8008998999203047, 0, 0 },
+	{ "prelude", "passwords", 766, 9.581200581924957, 0, 9.581200581924957, 0, 0 },
+	{ "brutus", "passwords", 533, 9.0579917227591764, 0, 9.0579917227591764, 0, 0 },
+	{ "6969", "passwords", 42, 5.3923174227787607, 0, 5.3923174227787607, 0, 0 },
+	{ "asdfgh", "passwords", 78, 6.2854022188622487, 0, 6.2854022188622487, 0, 0 },
+	{ "babygirl", "passwords", 527, 9.041659151637214, 0, 9.041659151637214, 0, 0 },
+	{ "brother", "english", 401, 8.6474584264549197, 0, 8.6474584264549197, 0, 0 },
+	{ "bullet", "passwords", 715, 9.4817994316657526, 0, 9.4817994316657526, 0, 0 },
+	{ "asshole", "passwords", 41, 5.3575520046180838, 0, 5.3575520046180838, 0, 0 },
+	{ "mistress", "passwords", 579, 9.1774195379892358, 0, 9.1774195379892358, 0, 0 },
+	{ "adam", "male_names", 69, 6.1085244567781691, 0, 6.1085244567781691, 0, 0 },
+	{ "naked", "passwords", 582, 9.184875342908283, 0, 9.184875342908283, 0, 0 },
+	{ "melanie", "female_names", 187, 7.5468944598876364, 0, 7.5468944598876364, 0, 0 },
+	{ "bubba", "passwords", 216, 7.7548875021634682, 0, 7.7548875021634682, 0, 0 },
+	{ "bradley", "male_names", 124, 6.9541963103868749, 0, 6.9541963103868749, 0, 0 },
+	{ "qwert", "passwords", 358, 8.4838157772642564, 0, 8.4838157772642564, 0, 0 },
+	{ "franklin", "surnames", 184, 7.5235619560570131, 0, 7.5235619560570131, 0, 0 },
+	{ "crazy", "english", 409, 8.6759570329417492, 0, 8.6759570329417492, 0, 0 },
+	{ "jackass", "passwords", 294, 8.1996723448363635, 0, 8.1996723448363635, 0, 0 },
+	{ "none", "english", 647, 9.3376219019925077, 0, 9.3376219019925077, 0, 0 },
+	{ "nothing", "english", 155, 7.2761244052742375, 0, 7.2761244052742375, 0, 0 },
+	{ "texas", "passwords", 714, 9.4797802640290989, 0, 9.4797802640290989, 0, 0 },
+	{ "kristen", "female_names", 193, 7.5924570372680806, 0, 7.5924570372680806, 0, 0 },
+	{ "golf", "passwords", 199, 7.6366246205436488, 0, 7.6366246205436488, 0, 0 },
+	{ "bobafett", "passwords", 789, 9.6238814900134582, 0, 9.6238814900134582, 0, 0 },
+	{ "drummer", "passwords", 425, 8.7313190310250643, 0, 8.7313190310250643, 0, 0 },
+	{ "junior", "passwords", 130, 7.0223678130284544, 0, 7.0223678130284544, 0, 0 },
+	{ "admin", "passwords", 558, 9.1241213118291871, 0, 9.1241213118291871, 0, 0 },
+	{ "yankees", "passwords", 51, 5.6724253419714952, 0, 5.6724253419714952, 0, 0 },
+	{ "free", "passwords", 343, 8.422064766172813, 0, 8.422064766172813, 0, 0 },
+	{ "666666", "passwords", 53, 5.7279204545631988, 0, 5.7279204545631988, 0, 0 },
+	{ "gateway", "passwords", 108, 6.7548875021634682, 0, 6.7548875021634682, 0, 0 },
+	{ "shelby", "passwords", 340, 8.4093909361377026, 0, 8.4093909361377026, 0, 0 },
+	{ "dolphins", "passwords", 259, 8.0168082876865547, 0, 8.0168082876865547, 0, 0 },
+	{ "jeff", "male_names", 117, 6.8703647195834048, 0, 6.8703647195834048, 0, 0 },
+	{ "jupiter", "passwords", 520, 9.0223678130284544, 0, 9.0223678130284544, 0, 0 },
+	{ "compaq", "passwords", 119, 6.8948177633079437, 0, 6.8948177633079437, 0, 0 },
+	{ "georgia", "female_names", 229, 7.8392037880969436, 0, 7.8392037880969436, 0, 0 },
+	{ "sarah", "female_names", 23, 4.5235619560570131, 0, 4.5235619560570131, 0, 0 },
+	{ "scotty", "passwords", 436, 8.7681843247769269, 0, 8.7681843247769269, 0, 0 },
+	{ "wilson", "surnames", 8, 3, 0, 3, 0, 0 },
+	{ "kimberly", "female_names", 24, 4.5849625007211561, 0, 4.5849625007211561, 0, 0 },
+	{ "robert", "male_names", 3, 1.5849625007211561, 0, 1.5849625007211561, 0, 0 },
+	{ "strike", "passwords", 721, 9.4938554492408223, 0, 9.4938554492408223, 0, 0 },
+	{ "mark", "male_names", 14, 3.8073549220576042, 0, 3.8073549220576042, 0, 0 },
+	{ "cougar", "passwords", 492, 8.9425145053392399, 0, 8.9425145053392399, 0, 0 },
+	{ "toyota", "passwords", 209, 7.7073591320808825, 0, 7.7073591320808825, 0, 0 },
+	{ "london", "passwords", 162, 7.3398500028846243, 0, 7.3398500028846243, 0, 0 },
+	{ "bronco", "passwords", 327, 8.353146825498083, 0, 8.353146825498083, 0, 0 },
+	{ "olivia", "female_names", 346, 8.4346282276367255, 0, 8.4346282276367255, 0, 0 },
+	{ "apache", "passwords", 786, 9.6183855022586062, 0, 9.6183855022586062, 0, 0 },
+	{ "diablo", "passwords", 145, 7.1799090900149345, 0, 7.1799090900149345, 0, 0 },
+	{ "bitch", "passwords", 122, 6.9307373375628867, 0, 6.9307373375628867, 0, 0 },
+	{ "francis", "male_names", 123, 6.9425145053392399, 0, 6.9425145053392399, 0, 0 },
+	{ "chicago", "passwords", 149, 7.2191685204621612, 0, 7.2191685204621612, 0, 0 },
+	{ "sexy", "passwords", 59, 5.8826430493618416, 0, 5.8826430493618416, 0, 0 },
+	{ "birdie", "passwords", 306, 8.2573878426926512, 0, 8.2573878426926512, 0, 0 },
+	{ "samantha", "passwords", 100, 6.6438561897747244, 0, 6.6438561897747244, 0, 0 },
+	{ "popeye", "passwords", 712, 9.4757334309663985, 0, 9.4757334309663985, 0, 0 },
+	{ "balls", "passwords", 616, 9.2667865406949019, 0, 9.2667865406949019, 0, 0 },
+};
+
+const size_t zxcppvbn::common_verdict_seeds_size = 251;
+
+const uint32_t zxcppvbn::common_verdict_seeds[] = {
+	14, 180, 1, 4, 10, 3, 32, 108, 1, 4, 346, 328, 329, 54, 59, 109,
+	9, 139, 79, 255, 6, 60, 142, 1, 76, 1, 1, 2, 1, 216, 4, 155,
+	18, 123, 99, 78, 9, 5, 2, 136, 1, 6, 92, 3, 536, 38, 1, 244,
+	92, 2, 3, 3, 3, 172, 5, 372, 14, 16, 77, 34, 1, 0, 137, 457,
+	559, 59, 65, 0, 7, 27, 19, 29, 44, 0, 0, 57, 12, 4, 720, 861,
+	328, 91, 16, 63, 23, 149, 10, 1, 236, 327, 1137, 29, 25, 74, 8, 10,
+	17, 142, 615, 72, 963, 14, 853, 5, 51, 1, 22, 3, 96, 4, 0, 46,
+	245, 726, 33, 5, 9, 9, 15, 1, 1, 501, 349, 1, 0, 181, 3, 249,
+	193, 563, 101, 29, 246, 44, 176, 1, 3, 8, 10, 85, 297, 25, 1888, 834,
+	178, 1, 1, 1, 111, 1117, 171, 238, 24, 27, 13, 187, 5, 983, 2312, 34,
+	44, 6, 3772, 415, 243, 677, 3, 1, 1090, 1981, 41, 11, 7, 10, 3611, 2,
+	830, 8, 1, 15, 29, 10, 604, 428, 3207, 1603, 68, 14, 2047, 96, 2, 525,
+	1, 26, 0, 172, 71, 836, 303, 560, 24, 9, 22, 174, 194, 16, 4, 59,
+	64, 733, 1, 1, 22, 1055, 0, 194, 17, 3, 5, 2827, 1, 1, 901, 66,
+	47, 15, 8183, 5, 274, 790, 106, 81, 68, 1, 1499, 728, 483, 117, 25, 4,
+	1583, 67, 14, 1000, 972, 142, 702, 2, 1767, 537, 38,
+};
+
+#endif
@@ -2,7 +2,17 @@
 
 #include "tools/tinf/tinf.h"
 
-#include <numeric>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <sstream>
+
+#ifdef ZXCPPVBN_MATCHERS
+// The expansion of a macro as a string literal
+#define ZXCPPVBN_STRINGIZE(...) ZXCPPVBN_STRINGIZE_ARGS(__VA_ARGS__)
+#define ZXCPPVBN_STRINGIZE_ARGS(...) #__VA_ARGS__
+#endif
 
 // Init to empty, no submatch without a valid pattern
 zxcppvbn::match::match(zxcppvbn::pattern p)
@@ -18,7 +28,7 @@ zxcppvbn::match::match(zxcppvbn::pattern p)
 
 // Init to empty
 zxcppvbn::result::result()
-	: password(), entropy(0.0), crack_time(0), crack_time_display(), score(0), matches(), calc_time(0)
+	: password(), entropy(0.0), crack_time(0), crack_time_display(), score(0), matches(), calc_time(0), phases(), allocations(), phase_allocations()
 {
 }
 
@@ -31,7 +41,7 @@ zxcppvbn::result::result(const result& o)
 zxcppvbn::result::result(result&& o)
 	: result()
 {
-	*this = o;
+	*this = std::move(o);
 }
 
 zxcppvbn::result& zxcppvbn::result::operator=(const result& o)
@@ -46,6 +56,9 @@ zxcppvbn::result& zxcppvbn::result::operator=(const result& o)
 			matches.push_back(std::unique_ptr<zxcppvbn::match>(new zxcppvbn::match(*match)));
 		}
 		calc_time = o.calc_time;
+		phases = o.phases;
+		allocations = o.allocations;
+		phase_allocations = o.phase_allocations;
 	}
 	return *this;
 }
@@ -60,10 +73,20 @@ zxcppvbn::result& zxcppvbn::result::operator=(result && o)
 		score = o.score;
 		matches = std::move(o.matches);
 		calc_time = std::move(o.calc_time);
+		phases = std::move(o.phases);
+		allocations = o.allocations;
+		phase_allocations = std::move(o.phase_allocations);
 	}
 	return *this;
 }
 
+// Default options
+zxcppvbn::options::options()
+	: reference_digits(false), reference_date_sep(false), reference_date_without_sep(false), parallel_threshold(0),
+	  hardened(false), max_length(256), max_l33t_subs(4), explain(true), phase_timings(false), verdict_cache(), update_metrics(true), common_verdicts(true)
+{
+}
+
 // Read compressed size from the end of the gzipped data
 size_t zxcppvbn::calc_decompressed_size(const uint8_t* comp_data, size_t comp_size) const
 {
@@ -74,94 +97,124 @@ size_t zxcppvbn::calc_decompressed_size(const uint8_t* comp_data, size_t comp_si
 	return dsize;
 }
 
-// Decompress and read dictionaries
-bool zxcppvbn::build_ranked_dicts()
+// Decompress a database from its byte array (null on failure)
+std::unique_ptr<uint8_t[]> zxcppvbn::decompress(const database& db) const
 {
-	// Decompress from byte array
-	tinf_init();
-	unsigned int dsize = calc_decompressed_size(frequency_lists, frequency_lists_size);
+	unsigned int dsize = calc_decompressed_size(db.data, db.size);
 	std::unique_ptr<uint8_t[]> raw(new uint8_t[dsize]);
-	if (tinf_gzip_uncompress(raw.get(), &dsize, frequency_lists, frequency_lists_size) != TINF_OK) {
-		return false;
+	if (tinf_gzip_uncompress(raw.get(), &dsize, db.data, db.size) != TINF_OK) {
+		return nullptr;
+	}
+	return raw;
+}
+
+// Decompress and read the dictionaries of the build profile. The full profile keeps each word only in the dictionary where it
+// ranks lowest, the lists mark the other occurrences with the dictionaries ranking the word lower or the same: one is kept when
+// they are all left out of the build, at the rank of the next word of the full profile so that the ranks of the others stay.
+bool zxcppvbn::build_ranked_dicts()
+{
+	// Bits of the masks of the marked words (scripts/build_frequency_lists.py)
+	static const char* const mask_dictionaries[] = { "passwords", "male_names", "female_names", "surnames", "english" };
+	unsigned compiled = 0;
+	for (const database* db = frequency_lists; db->name; db++) {
+		for (size_t d = 0; d < sizeof(mask_dictionaries) / sizeof(mask_dictionaries[0]); d++) {
+			compiled |= strcmp(db->name, mask_dictionaries[d]) ? 0 : 1u << d;
+		}
 	}
 
-	// Read simple format (file end - 0, dictionary end - 1, dictionary name and value separator - 2)
-	size_t i = 0;
-	while (raw[i] != 0) {
-		// Dictionary name
-		size_t dbegin = i;
-		while (raw[i] != 2) {
-			i++;
+	tinf_init();
+	for (const database* db = frequency_lists; db->name; db++) {
+		std::unique_ptr<uint8_t[]> raw = decompress(*db);
+		if (!raw) {
+			return false;
 		}
-		std::string d(&raw[dbegin], &raw[i++]);
-
-		// Dictionary words
-		int rank = 1;
-		std::map<std::string, int> l;
-		while (raw[i] != 1) {
-			// Word
-			size_t wbegin = i;
+
+		// Read simple format (file end - 0, dictionary end - 1, dictionary name and value separator - 2, marked word end - 3
+		// followed by 64 + the mask)
+		size_t i = 0;
+		while (raw[i] != 0) {
+			// Dictionary name
+			size_t dbegin = i;
 			while (raw[i] != 2) {
 				i++;
 			}
-			std::string w(&raw[wbegin], &raw[i++]);
+			std::string d(&raw[dbegin], &raw[i++]);
+
+			// Dictionary words
+			int rank = 1;
+			size_t max_length = 0;
+			std::map<std::string, int> l;
+			while (raw[i] != 1) {
+				// Word
+				size_t wbegin = i;
+				while (raw[i] > 3) {
+					i++;
+				}
+				// A marked word is dropped when a dictionary ranking it lower or the same is compiled in
+				bool marked = raw[i] == 3;
+				if (!marked || !((raw[i + 1] - 64) & compiled)) {
+					std::string w(&raw[wbegin], &raw[i]);
+					max_length = std::max(max_length, w.size());
+					l.insert(std::make_pair(std::move(w), marked ? rank : rank++));
+				}
+				i += marked ? 2 : 1;
+			}
 
-			l.insert(std::make_pair(std::move(w), rank++));
+			dictionary_max_lengths.insert(std::make_pair(d, max_length));
+			ranked_dictionaries.insert(std::make_pair(std::move(d), std::move(l)));
+			i++;
 		}
-
-		ranked_dictionaries.insert(std::make_pair(std::move(d), std::move(l)));
-		i++;
 	}
 	return true;
 }
 
-// Decompress and read keyboard adjacency graphs
+// Decompress and read the keyboard adjacency graphs of the build profile
 bool zxcppvbn::build_graphs()
 {
-	// Decompress from byte array
 	tinf_init();
-	unsigned int dsize = calc_decompressed_size(adjacency_graphs, adjacency_graphs_size);
-	std::unique_ptr<uint8_t[]> raw(new uint8_t[dsize]);
-	if (tinf_gzip_uncompress(raw.get(), &dsize, adjacency_graphs, adjacency_graphs_size) != TINF_OK) {
-		return false;
-	}
-
-	// Read simple format (file end - 0, keyboard end - 1, keyboard name and keys separator - 2, key and neighbors separator - 3)
-	size_t i = 0;
-	while (raw[i] != 0) {
-		// Keyboard name
-		size_t kbegin = i;
-		while (raw[i] != 2) {
-			i++;
+	for (const database* db = adjacency_graphs; db->name; db++) {
+		std::unique_ptr<uint8_t[]> raw = decompress(*db);
+		if (!raw) {
+			return false;
 		}
-		std::string k(&raw[kbegin], &raw[i++]);
-
-		// Keyboard neighbor maps
-		std::map<char, std::vector<std::string>> m;
-		while (raw[i] != 1) {
-			// Key
-			char c = raw[i++];
-			i++;
 
-			// Neighbor list
-			std::vector<std::string> l;
+		// Read simple format (file end - 0, keyboard end - 1, keyboard name and keys separator - 2, key and neighbors separator - 3)
+		size_t i = 0;
+		while (raw[i] != 0) {
+			// Keyboard name
+			size_t kbegin = i;
 			while (raw[i] != 2) {
-				// Neighbor characters
-				size_t wbegin = i;
-				while (raw[i] != 3) {
-					i++;
+				i++;
+			}
+			std::string k(&raw[kbegin], &raw[i++]);
+
+			// Keyboard neighbor maps
+			std::map<char, std::vector<std::string>> m;
+			while (raw[i] != 1) {
+				// Key
+				char c = raw[i++];
+				i++;
+
+				// Neighbor list
+				std::vector<std::string> l;
+				while (raw[i] != 2) {
+					// Neighbor characters
+					size_t wbegin = i;
+					while (raw[i] != 3) {
+						i++;
+					}
+					std::string w(&raw[wbegin], &raw[i++]);
+
+					l.push_back(std::move(w));
 				}
-				std::string w(&raw[wbegin], &raw[i++]);
 
-				l.push_back(std::move(w));
+				m.insert(std::make_pair(std::move(c), std::move(l)));
+				i++;
 			}
 
-			m.insert(std::make_pair(std::move(c), std::move(l)));
+			graphs.insert(std::make_pair(std::move(k), std::move(m)));
 			i++;
 		}
-
-		graphs.insert(std::make_pair(std::move(k), std::move(m)));
-		i++;
 	}
 	return true;
 }
@@ -169,42 +222,32 @@ bool zxcppvbn::build_graphs()
 // Calculate keyboard statistics
 void zxcppvbn::build_graph_stats()
 {
-	// Calculate average number of neighboring characters
-	auto calc_average_degree = [](const std::map<char /* key */, std::vector<std::string /* keys */> /* neigbors */>& graph) -> double {
-		double average = 0;
-		for (auto& key : graph)
-		{
-			average += std::accumulate(key.second.begin(), key.second.end(), 0.0, [](double a, const std::string & s) -> double { return a + (double)s.size(); });
-		}
-		return average / (double)graph.size();
-	};
-	// Calculate number of keys
-	auto calc_starting_positions = [](const std::map<char /* key */, std::vector<std::string /* keys */> /* neigbors */>& graph) -> double {
-		return (double)graph.size();
-	};
-
-	// Calculate stats
-	for (auto& graph : graphs) {
+	// Average the precomputed statistics of all the graphs of each type, compiled in or not, so that the entropies do not
+	// depend on the build profile
+	std::map<uint8_t /* keyboard type */, size_t /* graphs */> counts;
+	for (const graph_statistics* graph = adjacency_graph_statistics; graph->name; graph++) {
 		// 1- alphanumeric, 2 - keypad
-		uint8_t type = (graph.first.find("keypad") == std::string::npos) ? 1 : 2;
-		double degree = calc_average_degree(graph.second);
-		double start = calc_starting_positions(graph.second);
+		uint8_t type = (std::string(graph->name).find("keypad") == std::string::npos) ? 1 : 2;
 
 		// Update stats for the given type
 		auto it = graph_stats.find(type);
 		if (it == graph_stats.end()) {
-			graph_stats.insert(std::make_pair(type, std::make_tuple(std::vector<std::string>(1, graph.first), degree, start)));
+			graph_stats.insert(std::make_pair(type, std::make_tuple(std::vector<std::string>(), graph->average_degree, graph->starting_positions)));
+			counts[type] = 1;
 		} else {
-			std::vector<std::string>& k = std::get<0>(it->second);
 			double& d = std::get<1>(it->second);
 			double& s = std::get<2>(it->second);
 
-			double n = (double)k.size();
-			k.push_back(graph.first);
-			d = (d * n + degree) / (n + 1);
-			s = (s * n + start) / (n + 1);
+			double n = (double)counts[type]++;
+			d = (d * n + graph->average_degree) / (n + 1);
+			s = (s * n + graph->starting_positions) / (n + 1);
 		}
 	}
+
+	// Only the compiled graphs are matched
+	for (auto& graph : graphs) {
+		std::get<0>(graph_stats.at((graph.first.find("keypad") == std::string::npos) ? 1 : 2)).push_back(graph.first);
+	}
 }
 
 // Initialize forward l33t substitution table (so small it does not worth compressing)
@@ -254,76 +297,315 @@ void zxcppvbn::build_cardinalities()
 	add_class_cardinality('A', 'Z', 0);
 	add_class_cardinality('\0', '\x7f', 33);
 	add_class_cardinality('\0', '\xff', 100);
+
+	// Find the first matching character class of every character
+	size_t char_classes_count = char_classes_cardinality.size();
+	for (size_t c = 0; c < 256; c++) {
+		char ord = (char)c;
+		cardinality_classes[c] = 0;
+		for (size_t i = 0; i < char_classes_count; i++) {
+			auto& cc = char_classes_cardinality[i];
+			if (std::get<0>(cc) <= ord && ord <= std::get<1>(cc)) {
+				cardinality_classes[c] = (uint8_t)(1 << i);
+				break;
+			}
+		}
+	}
+
+	// Sum the cardinalities of every combination of character classes
+	class_mask_cardinalities.assign((size_t)1 << char_classes_count, 0);
+	for (size_t mask = 0; mask < class_mask_cardinalities.size(); mask++) {
+		for (size_t i = 0; i < char_classes_count; i++) {
+			if (mask & ((size_t)1 << i)) {
+				class_mask_cardinalities[mask] += std::get<2>(char_classes_cardinality[i]);
+			}
+		}
+	}
 }
 
-// Create dictionary matcher functions for each dictionaries
-void zxcppvbn::build_dict_matchers()
+// Precompute the validity of every two-digit month and day pair
+void zxcppvbn::build_daymonth_table()
 {
-	for (auto& dict : ranked_dictionaries) {
-		dictionary_matchers.push_back(std::bind(&zxcppvbn::dictionary_match, this, std::placeholders::_1, dict.first));
+	for (uint16_t m = 0; m < 100; m++) {
+		for (uint16_t d = 0; d < 100; d++) {
+			uint16_t month = m;
+			uint16_t day = d;
+			if (!check_date(min_year, month, day)) {
+				daymonth_table[m][d] = 0;
+			} else {
+				daymonth_table[m][d] = (month == m) ? 1 : 2;
+			}
+		}
 	}
 }
 
-// Create general matcher functions
-void zxcppvbn::build_matchers()
+// Precompute the character classes of every character
+void zxcppvbn::build_char_classes()
 {
-	// Add dictionary matchers to general matchers
-	matchers.insert(matchers.end(), dictionary_matchers.begin(), dictionary_matchers.end());
-	matchers.push_back(std::bind(&zxcppvbn::l33t_match, this, std::placeholders::_1));
-	matchers.push_back(std::bind(&zxcppvbn::spatial_match, this, std::placeholders::_1));
-	matchers.push_back(std::bind(&zxcppvbn::repeat_match, this, std::placeholders::_1));
-	matchers.push_back(std::bind(&zxcppvbn::sequence_match, this, std::placeholders::_1));
-	matchers.push_back(std::bind(&zxcppvbn::digits_match, this, std::placeholders::_1));
-	matchers.push_back(std::bind(&zxcppvbn::year_match, this, std::placeholders::_1));
-	matchers.push_back(std::bind(&zxcppvbn::date_match, this, std::placeholders::_1));
+	std::fill(std::begin(char_classes), std::end(char_classes), 0);
+	for (char c = '0'; c <= '9'; c++) {
+		char_classes[(uint8_t)c] |= CHAR_DIGIT | CHAR_ALPHANUMERIC;
+	}
+	for (char c = 'a'; c <= 'z'; c++) {
+		char_classes[(uint8_t)c] |= CHAR_LETTER | CHAR_ALPHANUMERIC;
+		char_classes[(uint8_t)(c - 'a' + 'A')] |= CHAR_LETTER | CHAR_ALPHANUMERIC;
+	}
+	for (auto& l : l33t_table) {
+		for (char c : l.second) {
+			char_classes[(uint8_t)c] |= CHAR_L33T;
+		}
+	}
+	for (char c : std::string(" \t\n\v\f\r-/\\_.")) {
+		char_classes[(uint8_t)c] |= CHAR_SEPARATOR;
+	}
+	for (auto& name : std::get<0>(graph_stats.at(2))) {
+		for (auto& key : graphs.at(name)) {
+			char_classes[(uint8_t)key.first] |= CHAR_KEYPAD;
+		}
+	}
 }
 
-// Create entropy calculation functions
-void zxcppvbn::build_entropy_functions()
+// Precompute the entropy of the values that are common in matches
+void zxcppvbn::build_entropy_tables()
 {
-	entropy_functions.insert(std::make_pair(pattern::DICTIONARY, std::bind(&zxcppvbn::dictionary_entropy, this, std::placeholders::_1)));
-	entropy_functions.insert(std::make_pair(pattern::L33T, std::bind(&zxcppvbn::l33t_entropy, this, std::placeholders::_1)));
-	entropy_functions.insert(std::make_pair(pattern::SPATIAL, std::bind(&zxcppvbn::spatial_entropy, this, std::placeholders::_1)));
-	entropy_functions.insert(std::make_pair(pattern::REPEAT, std::bind(&zxcppvbn::repeat_entropy, this, std::placeholders::_1)));
-	entropy_functions.insert(std::make_pair(pattern::SEQUENCE, std::bind(&zxcppvbn::sequence_entropy, this, std::placeholders::_1)));
-	entropy_functions.insert(std::make_pair(pattern::DIGITS, std::bind(&zxcppvbn::digits_entropy, this, std::placeholders::_1)));
-	entropy_functions.insert(std::make_pair(pattern::YEAR, std::bind(&zxcppvbn::year_entropy, this, std::placeholders::_1)));
-	entropy_functions.insert(std::make_pair(pattern::DATE, std::bind(&zxcppvbn::date_entropy, this, std::placeholders::_1)));
+	// Dictionary ranks
+	size_t max_rank = 0;
+	for (auto& dict : ranked_dictionaries) {
+		max_rank = std::max(max_rank, dict.second.size());
+	}
+	log2_ranks.resize(max_rank + 1);
+	for (size_t rank = 1; rank <= max_rank; rank++) {
+		log2_ranks[rank] = ::log2((double)rank);
+	}
+
+	// Number of ways to select at most k items out of n (uppercase, l33t and shifted characters)
+	for (size_t n = 0; n < entropy_table_size; n++) {
+		uint64_t sum = 0;
+		double shift_sum = 0;
+		for (size_t k = 0; k < entropy_table_size; k++) {
+			sum += nCk(n, k);
+			shift_sum += nCk(n, k);
+			binomial_sums[n][k] = sum;
+			binomial_sum_entropies[n][k] = ::log2((double)sum);
+			shift_entropies[n][k] = ::log2(shift_sum);
+		}
+	}
+
+	// Keyboard patterns by length and number of turns (the sum is extended one length at a time, in the order spatial_entropy sums)
+	for (auto& stat : graph_stats) {
+		for (auto& name : std::get<0>(stat.second)) {
+			graph_types.insert(std::make_pair(name, stat.first));
+		}
+		double d = std::get<1>(stat.second);
+		double s = std::get<2>(stat.second);
+
+		std::vector<double>& table = spatial_entropies[stat.first];
+		table.resize(entropy_table_size * entropy_table_size);
+		for (size_t t = 0; t < entropy_table_size; t++) {
+			double possibilities = 0;
+			for (size_t i = 0; i < entropy_table_size; i++) {
+				if (i >= 2) {
+					size_t possible_turns = std::min(t, i - 1);
+					for (size_t j = 1; j <= possible_turns; j++) {
+						possibilities += nCk(i - 1, j - 1) * s * ::pow(d, j);
+					}
+				}
+				table[i * entropy_table_size + t] = ::log2(possibilities);
+			}
+		}
+	}
+
+	// Digits, years and dates
+	for (size_t len = 0; len < entropy_table_size; len++) {
+		digits_entropies[len] = ::log2(::pow(10.0, len));
+	}
+	year_entropy_value = ::log2((double)(max_year - min_year));
+	date_entropy_values[0] = ::log2((double)(max_day * max_month * 100));
+	date_entropy_values[1] = ::log2((double)(max_day * max_month * (max_year - min_year)));
 }
 
+// Describe the options and the build profile that change the verdicts: the dictionaries (with their sizes), keyboard graphs and
+// matcher stages compiled in, the reference matchers in use and the hardened limits
+void zxcppvbn::build_cache_scope()
+{
+	std::ostringstream scope;
+	for (auto& dict : ranked_dictionaries) {
+		if (dict.first != "user_inputs") {
+			scope << "dictionary " << dict.first << " " << dict.second.size() << "\n";
+		}
+	}
+	for (auto& graph : graphs) {
+		scope << "graph " << graph.first << "\n";
+	}
+#ifdef ZXCPPVBN_MATCHERS
+	scope << "matchers " << ZXCPPVBN_STRINGIZE(ZXCPPVBN_MATCHERS) << "\n";
+#endif
+#if ZXCPPVBN_REFERENCE_MATCHERS
+	scope << "reference " << opts.reference_digits << opts.reference_date_sep << opts.reference_date_without_sep << "\n";
+#endif
+	if (opts.hardened) {
+		scope << "hardened " << opts.max_length << " " << opts.max_l33t_subs << "\n";
+	}
+	cache_scope = scope.str();
+}
 
 // Initialize the class
-zxcppvbn::zxcppvbn()
+zxcppvbn::zxcppvbn(const options& opts /* = options() */)
+	: opts(opts)
 {
 	// Initialize databases
 	build_ranked_dicts();
 	ranked_dictionaries.insert(std::make_pair("user_inputs", std::map<std::string, int>()));
+	dictionary_max_lengths.insert(std::make_pair("user_inputs", 0));
 	build_graphs();
 	build_graph_stats();
 	build_l33t_table();
 	build_sequences();
 	build_cardinalities();
+	build_daymonth_table();
+	build_char_classes();
+	build_entropy_tables();
+	build_cache_scope();
+}
 
-	// Initialize matchers
-	build_dict_matchers();
-	build_matchers();
-	build_entropy_functions();
+// Seeded FNV-1a hash of the password
+uint64_t zxcppvbn::common_verdict_hash(const std::string& password, uint32_t seed)
+{
+	uint64_t hash = 0xcbf29ce484222325ULL ^ (seed * 0x9e3779b97f4a7c15ULL);
+	for (char chr : password) {
+		hash = (hash ^ (uint8_t)chr) * 0x100000001b3ULL;
+	}
+	return hash ^ (hash >> 32);
 }
 
-zxcppvbn::result zxcppvbn::operator()(const std::string& password, const std::vector<std::string>& user_inputs /* = std::vector<std::string>() */)
+// Find the precomputed verdict of the password (none if there are user inputs, which could lower its entropy)
+const zxcppvbn::common_verdict* zxcppvbn::find_common_verdict(const std::string& password, const std::vector<std::string>& user_inputs) const
+{
+#if !ZXCPPVBN_FULL_PROFILE
+	// The verdicts were computed with all the dictionaries, graphs and matchers
+	return nullptr;
+#else
+	if (!opts.common_verdicts || !user_inputs.empty() || common_verdicts_size == 0 || (opts.hardened && password.size() > opts.max_length)) {
+		return nullptr;
+	}
+	uint32_t seed = common_verdict_seeds[common_verdict_hash(password, 0) % common_verdict_seeds_size];
+	const common_verdict& verdict = common_verdicts[common_verdict_hash(password, seed) % common_verdicts_size];
+	return (password == verdict.password) ? &verdict : nullptr;
+#endif
+}
+
+// Rebuild the result of a precomputed verdict, as operator() would calculate it
+zxcppvbn::result zxcppvbn::common_verdict_result(const std::string& password, const common_verdict& verdict) const
 {
-	std::chrono::system_clock::time_point start = std::chrono::system_clock::now();
+	std::unique_ptr<match> match(new zxcppvbn::match(pattern::DICTIONARY));
+	match->i = 0;
+	match->j = password.size() - 1;
+	match->token = password;
+	match->entropy = verdict.entropy;
+	match->dictionary_name = verdict.dictionary_name;
+	match->matched_word = to_lower(password);
+	match->rank = verdict.rank;
+	match->base_entropy = verdict.base_entropy;
+	match->uppercase_entropy = verdict.uppercase_entropy;
+
+	result res;
+	res.entropy = verdict.entropy;
+	res.crack_time = std::chrono::seconds(verdict.crack_time);
+	res.score = verdict.score;
+	res.matches.push_back(std::move(match));
+	if (opts.explain) {
+		res.password = password;
+		res.crack_time_display = calc_display_time(verdict.crack_time);
+	}
+	return std::move(res);
+}
 
+// Find the matches of the password, keeping the per_span lowest entropy matches of each span, and their offsets by end position
+std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::find_matches(const std::string& password, const std::vector<std::string>& user_inputs, size_t per_span, std::vector<size_t>& ends, phase_timer& timer)
+{
 	// Initialize user input dictionary (we assume that rank is proportional to the position in the array)
 	std::map<std::string, int>& ranked_user_inputs_dict = ranked_dictionaries.at("user_inputs");
+	size_t& user_inputs_max_length = dictionary_max_lengths.at("user_inputs");
 	ranked_user_inputs_dict.clear();
+	user_inputs_max_length = 0;
 	for (size_t i = 0; i < user_inputs.size(); i++) {
 		ranked_user_inputs_dict[to_lower(user_inputs[i])] = i + 1;
+		user_inputs_max_length = std::max(user_inputs_max_length, user_inputs[i].size());
+	}
+	timer.lap("user_inputs");
+
+	// in hardened mode, only the beginning of long passwords is matched
+	std::vector<std::unique_ptr<match>> matches;
+	if (opts.hardened && password.size() > opts.max_length) {
+		matches = omnimatch(password.substr(0, opts.max_length), ends, timer);
+		// no match ends in the rest of the password
+		ends.resize(password.size() + 1, ends.back());
+	} else {
+		matches = omnimatch(password, ends, timer);
 	}
+	prune_matches(matches, ends, per_span);
+	timer.lap("prune");
+	return std::move(matches);
+}
 
-	// calculate result
-	std::vector<std::unique_ptr<match>> matches = omnimatch(password);
-	result res = minimum_entropy_match_sequence(password, matches);
-	res.calc_time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - start);
+zxcppvbn::result zxcppvbn::operator()(const std::string& password, const std::vector<std::string>& user_inputs /* = std::vector<std::string>() */)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	phase_times phases;
+	allocation_phases phase_allocations;
+#ifdef ZXCPPVBN_ALLOC_ACCOUNTING
+	phase_timer timer(opts.phase_timings ? &phases : nullptr, &phase_allocations);
+#else
+	phase_timer timer(opts.phase_timings ? &phases : nullptr);
+#endif
+
+	// calculate result (the most common passwords are precomputed)
+	result res;
+	const common_verdict* verdict = find_common_verdict(password, user_inputs);
+	if (verdict) {
+		res = common_verdict_result(password, *verdict);
+		count_metric(METRIC_COMMON_VERDICT_HITS);
+		timer.lap("common_verdict");
+	} else {
+		std::vector<size_t> ends;
+		std::vector<std::unique_ptr<match>> matches = find_matches(password, user_inputs, 1, ends, timer);
+		res = minimum_entropy_match_sequence(password, matches, ends, timer);
+	}
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	res.calc_time = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+	res.phases = std::move(phases);
+	res.allocations = timer.total();
+	res.phase_allocations = std::move(phase_allocations);
+	if (timer.traced) {
+		trace_event("evaluation", start, end, (int64_t)password.size());
+	}
+	record_latency_metrics(password.size(), res);
 	return std::move(res);
 }
+
+std::vector<zxcppvbn::result> zxcppvbn::k_best(const std::string& password, size_t k, const std::vector<std::string>& user_inputs /* = std::vector<std::string>() */)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	allocation_phases phase_allocations;
+#ifdef ZXCPPVBN_ALLOC_ACCOUNTING
+	phase_timer timer(nullptr, &phase_allocations);
+#else
+	phase_timer timer(nullptr);
+#endif
+
+	// calculate results
+	std::vector<size_t> ends;
+	std::vector<std::unique_ptr<match>> matches = find_matches(password, user_inputs, k, ends, timer);
+	std::vector<result> results = k_minimum_entropy_match_sequences(password, matches, ends, k);
+	timer.lap("scoring");
+	count_metric(METRIC_EVALUATIONS);
+	// the results share the time and the allocations of the whole call
+	std::chrono::nanoseconds calc_time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+	allocation_stats allocations = timer.total();
+	for (auto& res : results) {
+		res.calc_time = calc_time;
+		res.allocations = allocations;
+		res.phase_allocations = phase_allocations;
+	}
+	return std::move(results);
+}
@@ -2,6 +2,9 @@
 
 #include <algorithm>
 #include <cctype>
+#include <iterator>
+#include <limits>
+#include <numeric>
 #include <set>
 #include <sstream>
 
@@ -43,22 +46,207 @@ std::string zxcppvbn::substr(const std::string& password, size_t i, size_t j) co
 /// Complex matching
 //////////////////////////////////////////////////////////////////////////
 
-// Combine match results
-std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::omnimatch(const std::string& password) const
+// Find all character classes present in the password in one pass
+uint8_t zxcppvbn::prescan(const std::string& password) const
+{
+	uint8_t classes = 0;
+	for (char chr : password) {
+		classes |= char_classes[(uint8_t)chr];
+	}
+	return classes;
+}
+
+// Combine match results, ordered by their end position: the matches ending at k are in [ends[k], ends[k + 1])
+std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::omnimatch(const std::string& password, std::vector<size_t>& ends, phase_timer& timer) const
 {
 	std::vector<std::unique_ptr<match>> results;
-	// Invoke all matchers and collect results
-	for (auto& matcher : matchers) {
-		std::vector<std::unique_ptr<match>> matches = matcher(password);
-		results.insert(results.end(), std::make_move_iterator(matches.begin()), std::make_move_iterator(matches.end()));
+	ends.clear();
+	uint8_t classes = prescan(password);
+	timer.lap("prescan");
+	if (opts.parallel_threshold > 0 && password.size() >= opts.parallel_threshold) {
+		// Invoke all matchers that can find something concurrently, the evaluating thread runs the first one
+		matcher_tasks tasks;
+		tasks.pending = 0;
+		launch_matchers(matchers(), password, classes, tasks);
+		if (tasks.first) {
+			tasks.first();
+		}
+		{
+			std::unique_lock<std::mutex> guard(tasks.lock);
+			tasks.finished.wait(guard, [&tasks]() { return tasks.pending == 0; });
+		}
+		// Collect results in pipeline order, this gives the same order as the serial matching, and sum the counts of the matches
+		// by end index the tasks made into the end index buckets
+		ends.assign(password.size() + 1, 0);
+		for (auto& task : tasks.tasks) {
+			if (task.error) {
+				std::rethrow_exception(task.error);
+			}
+#ifdef ZXCPPVBN_ALLOC_ACCOUNTING
+			add_task_allocations(task.allocations, task.live_bytes);
+#endif
+			results.insert(results.end(), std::make_move_iterator(task.matches.begin()), std::make_move_iterator(task.matches.end()));
+			for (size_t k = 0; k < task.ends.size(); k++) {
+				ends[k] += task.ends[k];
+			}
+		}
+		std::partial_sum(ends.begin(), ends.end(), ends.begin());
+		// the matchers overlap, so they are timed together
+		timer.lap("matchers");
+	} else {
+		// Invoke all matchers that can find something and collect results
+		run_matchers(matchers(), password, classes, results, timer);
 	}
-	// Sort match results according to their position in the input
+	if (opts.update_metrics) {
+		uint64_t counts[metrics::pattern_count] = {};
+		for (auto& match : results) {
+			counts[(size_t)match->pattern]++;
+		}
+		for (size_t p = 0; p < metrics::pattern_count; p++) {
+			if (counts[p] > 0) {
+				count_metric(METRIC_MATCHES + p, counts[p]);
+			}
+		}
+	}
+	// Sort match results according to their position in the input with std::sort (O(m log m), kept: the order it leaves the
+	// matches of a span in decides between equal entropy matches and a stable order reports other dates and graphs than the
+	// original), then order them by their end position with a counting sort (the scoring visits matches by their end position)
 	std::sort(results.begin(), results.end(), [](const std::unique_ptr<match>& match1, const std::unique_ptr<match>& match2) {
 		return (match1->i < match2->i) || ((match1->i == match2->i) && (match1->j < match2->j));
 	});
+	if (ends.empty()) {
+		ends = bucket_matches(results, password.size(), &match::j);
+	} else {
+		bucket_matches(results, ends, &match::j);
+	}
+	timer.lap("sort");
 	return std::move(results);
 }
 
+// Stable counting sort of matches by a position (i or j), returns the offsets of the position buckets in the sorted array:
+// matches at position k are in [offsets[k], offsets[k + 1])
+std::vector<size_t> zxcppvbn::bucket_matches(std::vector<std::unique_ptr<match>>& matches, size_t password_size, size_t match::* position)
+{
+	std::vector<size_t> offsets(password_size + 1, 0);
+	for (auto& match : matches) {
+		offsets[(*match).*position + 1]++;
+	}
+	std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+	bucket_matches(matches, offsets, position);
+	return std::move(offsets);
+}
+
+// Stable scatter of matches into the buckets of a position, given their offsets
+void zxcppvbn::bucket_matches(std::vector<std::unique_ptr<match>>& matches, const std::vector<size_t>& offsets, size_t match::* position)
+{
+	std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+	std::vector<std::unique_ptr<match>> sorted(matches.size());
+	for (auto& match : matches) {
+		sorted[next[(*match).*position]++] = std::move(match);
+	}
+	matches = std::move(sorted);
+}
+
+// Name of a matcher, for the phase timings
+const char* zxcppvbn::matcher_name(matcher_func matcher)
+{
+	static const std::pair<matcher_func, const char*> names[] = {
+		std::make_pair(&zxcppvbn::dictionaries_match, "dictionary_match"),
+		std::make_pair(&zxcppvbn::l33t_match, "l33t_match"),
+		std::make_pair(&zxcppvbn::spatial_match, "spatial_match"),
+		std::make_pair(&zxcppvbn::repeat_match, "repeat_match"),
+		std::make_pair(&zxcppvbn::sequence_match, "sequence_match"),
+		std::make_pair(&zxcppvbn::digits_match, "digits_match"),
+		std::make_pair(&zxcppvbn::year_match, "year_match"),
+		std::make_pair(&zxcppvbn::date_without_sep_match, "date_without_sep_match"),
+		std::make_pair(&zxcppvbn::date_sep_match, "date_sep_match")
+	};
+	for (auto& name : names) {
+		if (name.first == matcher) {
+			return name.second;
+		}
+	}
+	return "matcher";
+}
+
+// Invoke the first matcher of the pipeline if the password has the required character classes, then the rest of the pipeline
+template <zxcppvbn::pattern P, zxcppvbn::matcher_func M, uint8_t required_classes, typename... Stages>
+void zxcppvbn::run_matchers(matcher_list<matcher_stage<P, M, required_classes>, Stages...>, const std::string& password, uint8_t classes, std::vector<std::unique_ptr<match>>& results, phase_timer& timer) const
+{
+	if ((classes & required_classes) == required_classes) {
+		std::vector<std::unique_ptr<match>> matches = (this->*M)(password, classes);
+		results.insert(results.end(), std::make_move_iterator(matches.begin()), std::make_move_iterator(matches.end()));
+		timer.lap(timer.enabled() ? matcher_name(M) : nullptr);
+	}
+	run_matchers(matcher_list<Stages...>(), password, classes, results, timer);
+}
+
+// End of the pipeline
+void zxcppvbn::run_matchers(matcher_list<>, const std::string&, uint8_t, std::vector<std::unique_ptr<match>>&, phase_timer&) const
+{
+}
+
+// Run a matcher as a task of a parallel omnimatch and count its matches by end index
+template <zxcppvbn::matcher_func M>
+void zxcppvbn::run_matcher_task(const std::string& password, uint8_t classes, matcher_task& task) const
+{
+	try {
+		// trace the matcher on its thread
+		bool traced = tracing.load(std::memory_order_relaxed);
+		std::chrono::steady_clock::time_point begin = traced ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+		task.matches = (this->*M)(password, classes);
+		if (traced) {
+			trace_event(matcher_name(M), begin, std::chrono::steady_clock::now());
+		}
+		task.ends.assign(password.size() + 1, 0);
+		for (auto& match : task.matches) {
+			task.ends[match->j + 1]++;
+		}
+	} catch (...) {
+		task.error = std::current_exception();
+	}
+}
+
+// Queue the first matcher of the pipeline as a task if the password has the required character classes (the first task is left
+// to the evaluating thread), then the rest of the pipeline
+template <zxcppvbn::pattern P, zxcppvbn::matcher_func M, uint8_t required_classes, typename... Stages>
+void zxcppvbn::launch_matchers(matcher_list<matcher_stage<P, M, required_classes>, Stages...>, const std::string& password, uint8_t classes, matcher_tasks& tasks) const
+{
+	if ((classes & required_classes) == required_classes) {
+		tasks.tasks.push_back(matcher_task());
+		matcher_task* task = &tasks.tasks.back();
+		if (!tasks.first) {
+			tasks.first = [this, &password, classes, task]() { run_matcher_task<M>(password, classes, *task); };
+		} else {
+			{
+				std::lock_guard<std::mutex> guard(tasks.lock);
+				tasks.pending++;
+			}
+			matcher_tasks* batch = &tasks;
+			run_task([this, &password, classes, task, batch]() {
+#ifdef ZXCPPVBN_ALLOC_ACCOUNTING
+				allocation_scope scope = begin_allocations();
+				run_matcher_task<M>(password, classes, *task);
+				task->allocations = end_task_allocations(scope, task->live_bytes);
+#else
+				run_matcher_task<M>(password, classes, *task);
+#endif
+				// the evaluating thread may return as soon as the lock is released
+				std::lock_guard<std::mutex> guard(batch->lock);
+				if (--batch->pending == 0) {
+					batch->finished.notify_one();
+				}
+			});
+		}
+	}
+	launch_matchers(matcher_list<Stages...>(), password, classes, tasks);
+}
+
+// End of the pipeline
+void zxcppvbn::launch_matchers(matcher_list<>, const std::string&, uint8_t, matcher_tasks&) const
+{
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Dictionary matching
 //////////////////////////////////////////////////////////////////////////
@@ -67,12 +255,13 @@ std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::omnimatch(const std::str
 std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::dictionary_match(const std::string& password, const std::string& dictionary) const
 {
 	const std::map<std::string, int>& ranked_dict = ranked_dictionaries.at(dictionary);
+	size_t max_length = dictionary_max_lengths.at(dictionary);
 	std::vector<std::unique_ptr<match>> results;
 	size_t len = password.length();
 	std::string password_lower = to_lower(password);
-	// Try to match any substring of the password
+	// Try to match any substring of the password that is not longer than the longest word
 	for (size_t i /* substring start index */ = 0; i < len; i++) {
-		for (size_t j /* substring end index */ = i; j < len; j++) {
+		for (size_t j /* substring end index */ = i; j < len && j - i < max_length; j++) {
 			// Find a matching word in the dictionary
 			std::string password_part = substr(password_lower, i, j);
 			auto it = ranked_dict.find(password_part);
@@ -92,6 +281,18 @@ std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::dictionary_match(const s
 	return std::move(results);
 }
 
+// Find matches in all known dictionaries
+std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::dictionaries_match(const std::string& password, uint8_t) const
+{
+	std::vector<std::unique_ptr<match>> results;
+	// Invoke matcher for all dictionaries and collect results
+	for (auto& dict : ranked_dictionaries) {
+		std::vector<std::unique_ptr<match>> matches = dictionary_match(password, dict.first);
+		results.insert(results.end(), std::make_move_iterator(matches.begin()), std::make_move_iterator(matches.end()));
+	}
+	return std::move(results);
+}
+
 //////////////////////////////////////////////////////////////////////////
 // L33t matching
 //////////////////////////////////////////////////////////////////////////
@@ -117,8 +318,8 @@ std::map<char, std::vector<char>> zxcppvbn::relevent_l33t_subtable(const std::st
 	return std::move(filtered);
 }
 
-// Calculate all possible inverse l33t substitution maps
-std::vector<std::map<char, char>> zxcppvbn::enumerate_l33t_subs(const std::map<char, std::vector<char>>& table) const
+// Calculate all possible inverse l33t substitution maps (but not more than max_subs)
+std::vector<std::map<char, char>> zxcppvbn::enumerate_l33t_subs(const std::map<char, std::vector<char>>& table, size_t max_subs) const
 {
 	// First, we create the inverse of the original -> l33t* table to get a l33t -> original* mapping
 	std::map<char /* l33t */, std::vector<char /* original */>> inverse_map;
@@ -139,7 +340,7 @@ std::vector<std::map<char, char>> zxcppvbn::enumerate_l33t_subs(const std::map<c
 
 	// Try to find all permutations where each l33t character has only one original substitution (l33t -> original)*
 	std::vector<size_t /* index of original*/> choices(1, 0);       // Contain 1-based indexes in the inverse table -> which original character we choose out of the possible l33t->original* choices
-	while (!choices.empty()) {
+	while (!choices.empty() && sub_dicts.size() < max_subs) {
 		size_t current = choices.size() - 1;
 
 		// Select next choice at this level
@@ -175,7 +376,7 @@ std::vector<std::map<char, char>> zxcppvbn::enumerate_l33t_subs(const std::map<c
 }
 
 // Find all matches that can be found using possible l33t substitutions
-std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::l33t_match(const std::string& password) const
+std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::l33t_match(const std::string& password, uint8_t) const
 {
 	std::vector<std::unique_ptr<match>> matches;
 
@@ -184,13 +385,15 @@ std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::l33t_match(const std::st
 		return std::move(matches);
 	}
 
-	std::vector<std::map<char /* l33t */, char /* orig */>> substitutions = enumerate_l33t_subs(relevent);
+	size_t max_subs = opts.hardened ? opts.max_l33t_subs : std::numeric_limits<size_t>::max();
+	std::vector<std::map<char /* l33t */, char /* orig */>> substitutions = enumerate_l33t_subs(relevent, max_subs);
+	count_metric(METRIC_L33T_SUBS, substitutions.size());
 	// For each possible l33t->original substitutions
 	for (auto& sub : substitutions) {
 		std::string subbed_password = translate(password, sub);
 		// Call each dictionary matcher
-		for (auto& matcher : dictionary_matchers) {
-			std::vector<std::unique_ptr<match>> results = matcher(subbed_password);
+		for (auto& dict : ranked_dictionaries) {
+			std::vector<std::unique_ptr<match>> results = dictionary_match(subbed_password, dict.first);
 			// Enumerate match results
 			for (auto& match : results) {
 				std::string token = substr(password, match->i, match->j);
@@ -207,10 +410,12 @@ std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::l33t_match(const std::st
 				for (auto& it : sub) {
 					if (token.find(it.first) != std::string::npos) {
 						match->sub.insert(it);
-						if (!match->sub_display.empty()) {
-							match->sub_display.append(", ");
+						if (opts.explain) {
+							if (!match->sub_display.empty()) {
+								match->sub_display.append(", ");
+							}
+							match->sub_display.append(1, it.first).append(" -> ").append(1, it.second);
 						}
-						match->sub_display.append(1, it.first).append(" -> ").append(1, it.second);
 					}
 				}
 
@@ -306,13 +511,18 @@ std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::spatial_match_helper(con
 }
 
 // Find sequences of neighboring keyboard characters
-std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::spatial_match(const std::string& password) const
+std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::spatial_match(const std::string& password, uint8_t classes) const
 {
 	std::vector<std::unique_ptr<match>> results;
-	// Invoke matcher for all keyboard graphs and collect results
+	// keypads are skipped when the password has none of their keys
+	bool keypad_keys = (classes & CHAR_KEYPAD) != 0;
+	// Invoke matcher for all keyboard graphs (in name order, the order of the matches decides between equal entropy ones) and
+	// collect results
 	for (auto& graph : graphs) {
-		std::vector<std::unique_ptr<match>> matches = spatial_match_helper(password, graph.first, graph.second);
-		results.insert(results.end(), std::make_move_iterator(matches.begin()), std::make_move_iterator(matches.end()));
+		if (keypad_keys || graph_types.at(graph.first) != 2) {
+			std::vector<std::unique_ptr<match>> matches = spatial_match_helper(password, graph.first, graph.second);
+			results.insert(results.end(), std::make_move_iterator(matches.begin()), std::make_move_iterator(matches.end()));
+		}
 	}
 	return std::move(results);
 }
@@ -322,7 +532,7 @@ std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::spatial_match(const std:
 //////////////////////////////////////////////////////////////////////////
 
 // Find repeating characters
-std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::repeat_match(const std::string& password) const
+std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::repeat_match(const std::string& password, uint8_t) const
 {
 	std::vector<std::unique_ptr<match>> results;
 
@@ -354,7 +564,7 @@ std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::repeat_match(const std::
 }
 
 // Find character sequences
-std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::sequence_match(const std::string& password) const
+std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::sequence_match(const std::string& password, uint8_t) const
 {
 	// Calculate direction from string positions
 	auto getDirection = [](size_t n, size_t m) -> int {
@@ -430,11 +640,13 @@ std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::sequence_match(const std
 // Digits, years and dates matching
 //////////////////////////////////////////////////////////////////////////
 
+#if ZXCPPVBN_REFERENCE_MATCHERS
 // Find positions of all non-overlapping matches of the given regular expression
 std::vector<std::pair<size_t, size_t>> zxcppvbn::findall(const std::string& password, const std::regex& rx) const
 {
 	std::vector<std::pair<size_t, size_t>> matches;
 
+	count_metric(METRIC_REGEX_SEARCHES);
 	std::sregex_iterator it(password.begin(), password.end(), rx);
 	std::sregex_iterator end;
 	for (/* empty */; it != end; ++it) {
@@ -471,15 +683,74 @@ std::vector<std::tuple<size_t, size_t, std::vector<std::string>>> zxcppvbn::spli
 
 	return std::move(results);
 }
+#endif
+
+// Find positions of all non-overlapping runs of min_len to max_len digits (same semantics as searching for \d{min_len,max_len})
+template <size_t min_len, size_t max_len>
+std::vector<std::pair<size_t, size_t>> zxcppvbn::scan_digits(const std::string& password) const
+{
+	static_assert(0 < min_len && min_len <= max_len, "invalid digit run length bounds");
+	std::vector<std::pair<size_t, size_t>> matches;
+
+	size_t password_size = password.size();
+	for (size_t i = 0; i < password_size; /* empty */) {
+		if (password[i] < '0' || '9' < password[i]) {
+			i++;
+			continue;
+		}
+		// Find the end of the current digit run
+		size_t end = i + 1;
+		while (end < password_size && '0' <= password[end] && password[end] <= '9') {
+			end++;
+		}
+		// Greedily cut the run to matches, the leftover shorter than min_len is skipped
+		while (end - i >= min_len) {
+			size_t len = std::min(end - i, max_len);
+			matches.push_back(std::make_pair(i, i + len - 1));
+			i += len;
+		}
+		i = end;
+	}
+	return std::move(matches);
+}
+
+// Find positions of all non-overlapping year numbers (same semantics as searching for 19\d\d|200\d|201\d)
+std::vector<std::pair<size_t, size_t>> zxcppvbn::scan_years(const std::string& password) const
+{
+	auto is_digit = [](char chr) {
+		return '0' <= chr && chr <= '9';
+	};
+
+	std::vector<std::pair<size_t, size_t>> matches;
+
+	size_t password_size = password.size();
+	for (size_t i = 0; i + 4 <= password_size; /* empty */) {
+		const char* p = &password[i];
+		if (is_digit(p[3]) && ((p[0] == '1' && p[1] == '9' && is_digit(p[2])) || (p[0] == '2' && p[1] == '0' && (p[2] == '0' || p[2] == '1')))) {
+			matches.push_back(std::make_pair(i, i + 3));
+			i += 4;
+		} else {
+			i++;
+		}
+	}
+	return std::move(matches);
+}
 
+#if ZXCPPVBN_REFERENCE_MATCHERS
 // Regular expression for matching digits
 const std::regex zxcppvbn::digits_rx("\\d{3,}");
+#endif
 
 // Find all digit sequences
-std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::digits_match(const std::string& password) const
+std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::digits_match(const std::string& password, uint8_t) const
 {
 	std::vector<std::unique_ptr<match>> results;
-	for (auto& match : findall(password, digits_rx)) {
+#if ZXCPPVBN_REFERENCE_MATCHERS
+	std::vector<std::pair<size_t, size_t>> matches = opts.reference_digits ? findall(password, digits_rx) : scan_digits<3, std::string::npos>(password);
+#else
+	std::vector<std::pair<size_t, size_t>> matches = scan_digits<3, std::string::npos>(password);
+#endif
+	for (auto& match : matches) {
 		std::unique_ptr<zxcppvbn::match> result(new zxcppvbn::match(pattern::DIGITS));
 		result->i = match.first;
 		result->j = match.second;
@@ -489,14 +760,21 @@ std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::digits_match(const std::
 	return std::move(results);
 }
 
+#if ZXCPPVBN_REFERENCE_MATCHERS
 // Regular expression for matching years
 const std::regex zxcppvbn::year_rx("19\\d\\d|200\\d|201\\d");
+#endif
 
 // Find all year numbers
-std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::year_match(const std::string& password) const
+std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::year_match(const std::string& password, uint8_t) const
 {
 	std::vector<std::unique_ptr<match>> results;
-	for (auto& match : findall(password, year_rx)) {
+#if ZXCPPVBN_REFERENCE_MATCHERS
+	std::vector<std::pair<size_t, size_t>> matches = opts.reference_digits ? findall(password, year_rx) : scan_years(password);
+#else
+	std::vector<std::pair<size_t, size_t>> matches = scan_years(password);
+#endif
+	for (auto& match : matches) {
 		std::unique_ptr<zxcppvbn::match> result(new zxcppvbn::match(pattern::YEAR));
 		result->i = match.first;
 		result->j = match.second;
@@ -506,19 +784,12 @@ std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::year_match(const std::st
 	return std::move(results);
 }
 
-// Find all dates
-std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::date_match(const std::string& password) const
-{
-	std::vector<std::unique_ptr<zxcppvbn::match>> results = date_without_sep_match(password);
-	std::vector<std::unique_ptr<zxcppvbn::match>> matches = date_sep_match(password);
-	results.insert(results.end(), std::make_move_iterator(matches.begin()), std::make_move_iterator(matches.end()));
-	return std::move(results);
-}
-
+#if ZXCPPVBN_REFERENCE_MATCHERS
 // Regular expression to match all dates without separators
 const std::regex zxcppvbn::date_rx_without_sep("\\d{4,8}");
 
-std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::date_without_sep_match(const std::string& password) const
+// Find dates without separators using the regular expression above
+std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::date_without_sep_match_regex(const std::string& password) const
 {
 	std::vector<std::unique_ptr<zxcppvbn::match>> results;
 
@@ -586,7 +857,79 @@ std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::date_without_sep_match(c
 
 	return std::move(results);
 }
+#endif
+
+// Candidate splits of 4 to 8 digit tokens to year, month and day fields (position, length), in the order of the original candidate lists
+const uint8_t zxcppvbn::date_splits[5][4][6] = {
+	// 4 digits: 2-digit year prefix, 2-digit year suffix
+	{ { 0, 2, 2, 1, 3, 1 }, { 2, 2, 0, 1, 1, 1 } },
+	// 5 digits: 2-digit year prefix, 2-digit year suffix
+	{ { 0, 2, 2, 2, 4, 1 }, { 0, 2, 2, 1, 3, 2 }, { 3, 2, 0, 2, 2, 1 }, { 3, 2, 0, 1, 1, 2 } },
+	// 6 digits: 2-digit year prefix, 2-digit year suffix, 4-digit year prefix, 4-digit year suffix
+	{ { 0, 2, 2, 2, 4, 2 }, { 4, 2, 0, 2, 2, 2 }, { 0, 4, 4, 1, 5, 1 }, { 2, 4, 0, 1, 1, 1 } },
+	// 7 digits: 4-digit year prefix, 4-digit year suffix
+	{ { 0, 4, 4, 2, 6, 1 }, { 0, 4, 4, 1, 5, 2 }, { 3, 4, 0, 2, 2, 1 }, { 3, 4, 0, 1, 1, 2 } },
+	// 8 digits: 4-digit year prefix, 4-digit year suffix
+	{ { 0, 4, 4, 2, 6, 2 }, { 4, 4, 0, 2, 2, 2 } }
+};
+
+// Find dates without separators
+std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::date_without_sep_match(const std::string& password, uint8_t) const
+{
+#if ZXCPPVBN_REFERENCE_MATCHERS
+	if (opts.reference_date_without_sep) {
+		return date_without_sep_match_regex(password);
+	}
+#endif
+
+	std::vector<std::unique_ptr<zxcppvbn::match>> results;
 
+	for (auto& match : scan_digits<4, 8>(password)) {
+		size_t i = match.first;
+		size_t j = match.second;
+		const char* token = &password[i];
+
+		// Integer value of a field of the token
+		auto value = [token](size_t pos, size_t len) -> uint16_t {
+			uint16_t v = 0;
+			for (size_t k = pos; k < pos + len; k++) {
+				v = v * 10 + (token[k] - '0');
+			}
+			return v;
+		};
+
+		for (auto& split : date_splits[j - i + 1 - 4]) {
+			// Unused entries have zero length
+			if (split[1] == 0) {
+				break;
+			}
+			uint16_t y = value(split[0], split[1]);
+			uint16_t m = value(split[2], split[3]);
+			uint16_t d = value(split[4], split[5]);
+
+			// Add result if valid date (same as check_date)
+			uint8_t validity = daymonth_table[m][d];
+			if (validity == 0 || !check_year(y)) {
+				continue;
+			}
+			if (validity == 2) {
+				std::swap(m, d);
+			}
+			std::unique_ptr<zxcppvbn::match> result(new zxcppvbn::match(pattern::DATE));
+			result->i = i;
+			result->j = j;
+			result->token = substr(password, i, j);
+			result->day = d;
+			result->month = m;
+			result->year = y;
+			results.push_back(std::move(result));
+		}
+	}
+
+	return std::move(results);
+}
+
+#if ZXCPPVBN_REFERENCE_MATCHERS
 // Regular expression to match all dates with separators (mm/dd/yyyy)
 const std::regex zxcppvbn::date_rx_year_suffix("(\\d{1,2})(\\s|-|/|\\\\|_|\\.)(\\d{1,2})\\2(19\\d{2}|200\\d|201\\d|\\d{2})");
 // Regular expression to match all dates with separators (yyyy/mm/dd)
@@ -594,8 +937,8 @@ const std::regex zxcppvbn::date_rx_year_prefix("(19\\d{2}|200\\d|201\\d|\\d{2})(
 // Regular expression to find numbers in dates with separators
 const std::regex zxcppvbn::date_rx_split("\\d{1,4}");
 
-// Find dates with separator characters
-std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::date_sep_match(const std::string& password) const
+// Find dates with separator characters using the regular expressions above
+std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::date_sep_match_regex(const std::string& password) const
 {
 	std::vector<std::unique_ptr<zxcppvbn::match>> results;
 
@@ -636,6 +979,143 @@ std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::date_sep_match(const std
 
 	return std::move(results);
 }
+#endif
+
+// Recognize all non-overlapping dates with separators in a single pass, both in the d{1,2} sep d{1,2} sep year and in the
+// year sep d{1,2} sep d{1,2} form, with the same semantics as searching for date_rx_year_suffix and date_rx_year_prefix.
+// Every field of these patterns is determined by its first character (a greedy field can never backtrack to a shorter one,
+// because then a digit would stand where a separator is expected), so the recognizer needs no backtracking at all.
+void zxcppvbn::scan_sep_dates(const std::string& password, std::vector<sep_date>& suffix_dates, std::vector<sep_date>& prefix_dates) const
+{
+	size_t password_size = password.size();
+
+	auto is_digit = [&password, password_size](size_t k) {
+		return k < password_size && '0' <= password[k] && password[k] <= '9';
+	};
+	auto is_sep = [&password, password_size](size_t k) {
+		if (k >= password_size) {
+			return false;
+		}
+		switch (password[k]) {
+		case ' ': case '\t': case '\n': case '\v': case '\f': case '\r':
+		case '-': case '/': case '\\': case '_': case '.':
+			return true;
+		default:
+			return false;
+		}
+	};
+	// Length of a day or month field at k (\d{1,2}), or zero
+	auto field_len = [&is_digit](size_t k) -> size_t {
+		return is_digit(k) ? (is_digit(k + 1) ? 2 : 1) : 0;
+	};
+	// Length of a year field at k (19\d{2}|200\d|201\d|\d{2}), or zero
+	auto year_len = [&password, &is_digit](size_t k) -> size_t {
+		if (is_digit(k + 2) && is_digit(k + 3) &&
+		        ((password[k] == '1' && password[k + 1] == '9') || (password[k] == '2' && password[k + 1] == '0' && password[k + 2] <= '1'))) {
+			return 4;
+		}
+		return (is_digit(k) && is_digit(k + 1)) ? 2 : 0;
+	};
+	// Value of a field as splitall and operator>> read it for the regular expression based search: the field positions are
+	// relative to the date but taken from the start of the password (the same for dates at index 0), then leading spaces and
+	// a sign are skipped and the digits read up to the first other character (no digit reads as 0, a minus sign wraps around)
+	auto value = [&password](size_t date, size_t k, size_t len) -> uint16_t {
+		size_t l = k - date;
+		size_t end = l + len;
+		while (l < end && (password[l] == ' ' || ('\t' <= password[l] && password[l] <= '\r'))) {
+			l++;
+		}
+		bool negative = false;
+		if (l < end && (password[l] == '+' || password[l] == '-')) {
+			negative = (password[l++] == '-');
+		}
+		uint16_t v = 0;
+		for (/* empty */; l < end && '0' <= password[l] && password[l] <= '9'; l++) {
+			v = v * 10 + (password[l] - '0');
+		}
+		return negative ? (uint16_t)-v : v;
+	};
+
+	// Each form continues searching after the end of its last match
+	size_t suffix_next = 0;
+	size_t prefix_next = 0;
+	for (size_t i = 0; i < password_size; i++) {
+		// d{1,2} sep d{1,2} sep year
+		if (i >= suffix_next) {
+			size_t first = field_len(i);
+			size_t sep1 = i + first;
+			if (first > 0 && is_sep(sep1)) {
+				size_t second = field_len(sep1 + 1);
+				size_t sep2 = sep1 + 1 + second;
+				if (second > 0 && sep2 < password_size && password[sep2] == password[sep1]) {
+					size_t year = year_len(sep2 + 1);
+					if (year > 0) {
+						size_t j = sep2 + year;
+						suffix_dates.push_back(sep_date(i, j, value(i, sep2 + 1, year), value(i, sep1 + 1, second), value(i, i, first), password[sep1 - i]));
+						suffix_next = j + 1;
+					}
+				}
+			}
+		}
+		// year sep d{1,2} sep d{1,2}
+		if (i >= prefix_next) {
+			size_t year = year_len(i);
+			size_t sep1 = i + year;
+			if (year > 0 && is_sep(sep1)) {
+				size_t second = field_len(sep1 + 1);
+				size_t sep2 = sep1 + 1 + second;
+				if (second > 0 && sep2 < password_size && password[sep2] == password[sep1]) {
+					size_t third = field_len(sep2 + 1);
+					if (third > 0) {
+						size_t j = sep2 + third;
+						prefix_dates.push_back(sep_date(i, j, value(i, i, year), value(i, sep1 + 1, second), value(i, sep2 + 1, third), password[sep1 - i]));
+						prefix_next = j + 1;
+					}
+				}
+			}
+		}
+	}
+}
+
+// Find dates with separator characters
+std::vector<std::unique_ptr<zxcppvbn::match>> zxcppvbn::date_sep_match(const std::string& password, uint8_t) const
+{
+#if ZXCPPVBN_REFERENCE_MATCHERS
+	if (opts.reference_date_sep) {
+		return date_sep_match_regex(password);
+	}
+#endif
+
+	std::vector<std::unique_ptr<zxcppvbn::match>> results;
+
+	std::vector<sep_date> suffix_dates;
+	std::vector<sep_date> prefix_dates;
+	scan_sep_dates(password, suffix_dates, prefix_dates);
+
+	// Keep the order of the regular expression based search: all year suffix dates first
+	for (auto* dates : { &suffix_dates, &prefix_dates }) {
+		for (auto& date : *dates) {
+			uint16_t y = std::get<2>(date);
+			uint16_t m = std::get<3>(date);
+			uint16_t d = std::get<4>(date);
+
+			// Add result if valid date
+			if (check_date(y, m, d)) {
+				std::unique_ptr<zxcppvbn::match> result(new zxcppvbn::match(pattern::DATE));
+				result->i = std::get<0>(date);
+				result->j = std::get<1>(date);
+				result->token = substr(password, result->i, result->j);
+				result->separator = std::string(1, std::get<5>(date));
+				result->day = d;
+				result->month = m;
+				result->year = y;
+				results.push_back(std::move(result));
+			}
+		}
+	}
+
+	return std::move(results);
+}
 
 // Check whether a given date is valid or not
 bool zxcppvbn::check_date(uint16_t year, uint16_t& month, uint16_t& day) const
@@ -648,6 +1128,13 @@ bool zxcppvbn::check_date(uint16_t year, uint16_t& month, uint16_t& day) const
 	if (max_day < day || day < min_day || max_month < month || month < min_month) {
 		return false;
 	}
+
+	return check_year(year);
+}
+
+// Check whether a given year is valid or not
+bool zxcppvbn::check_year(uint16_t year) const
+{
 	// Any two-digit years are accepted
 	if (year < 10 || (99 < year && year < min_year) || max_year < year) {
 		return false;
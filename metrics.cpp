@@ -0,0 +1,159 @@
+#include "zxcppvbn.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+//////////////////////////////////////////////////////////////////////////
+// Metrics storage
+//////////////////////////////////////////////////////////////////////////
+
+// Counters of one thread, only written by their thread (so relaxed loads and stores are enough), padded so that no other data
+// shares their first and last cache lines
+struct zxcppvbn::metrics_slot
+{
+	char padding_before[64];
+	std::atomic<uint64_t> counters[METRIC_COUNT];
+	char padding_after[64];
+
+	metrics_slot()
+	{
+		for (auto& counter : counters) {
+			counter.store(0, std::memory_order_relaxed);
+		}
+	}
+};
+
+// Slots of the running threads, and the totals of the threads that exited
+struct zxcppvbn::metrics_registry
+{
+	std::mutex lock;
+	std::vector<metrics_slot*> slots;
+	uint64_t retired[METRIC_COUNT];
+
+	metrics_registry()
+		: lock(), slots(), retired()
+	{
+	}
+};
+
+zxcppvbn::metrics_registry& zxcppvbn::registry()
+{
+	// Never destroyed, threads may still exit after the static destructors ran
+	static metrics_registry* registry = new metrics_registry();
+	return *registry;
+}
+
+// The slot of the calling thread, registered on first use and folded into the retired totals when the thread exits
+zxcppvbn::metrics_slot& zxcppvbn::local_metrics_slot()
+{
+	struct owner {
+		std::unique_ptr<metrics_slot> slot;
+
+		owner()
+			: slot(new metrics_slot())
+		{
+			metrics_registry& metrics = registry();
+			std::lock_guard<std::mutex> guard(metrics.lock);
+			metrics.slots.push_back(slot.get());
+		}
+
+		~owner()
+		{
+			metrics_registry& metrics = registry();
+			std::lock_guard<std::mutex> guard(metrics.lock);
+			for (size_t c = 0; c < METRIC_COUNT; c++) {
+				metrics.retired[c] += slot->counters[c].load(std::memory_order_relaxed);
+			}
+			metrics.slots.erase(std::find(metrics.slots.begin(), metrics.slots.end(), slot.get()));
+		}
+	};
+	static thread_local owner local;
+	return *local.slot;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Metrics updates
+//////////////////////////////////////////////////////////////////////////
+
+const char* const zxcppvbn::metrics::phase_names[zxcppvbn::metrics::phase_count] = {
+	"user_inputs", "prescan",
+	"dictionary_match", "l33t_match", "spatial_match", "repeat_match", "sequence_match",
+	"digits_match", "year_match", "date_without_sep_match", "date_sep_match", "matcher", "matchers",
+	"sort", "prune", "scoring", "assembly", "common_verdict"
+};
+
+void zxcppvbn::count_metric(size_t metric, uint64_t count /* = 1 */) const
+{
+	if (opts.update_metrics) {
+		std::atomic<uint64_t>& counter = local_metrics_slot().counters[metric];
+		counter.store(counter.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+	}
+}
+
+// Count an evaluation in the latency histograms of its password length, and of its phases
+void zxcppvbn::record_latency_metrics(size_t password_size, const result& res) const
+{
+	if (!opts.update_metrics) {
+		return;
+	}
+	auto latency_bucket = [](std::chrono::nanoseconds latency) {
+		size_t bucket = 0;
+		for (uint64_t ns = latency.count() > 0 ? latency.count() : 0; ns > 1 && bucket + 1 < metrics::latency_buckets; ns >>= 1) {
+			bucket++;
+		}
+		return bucket;
+	};
+
+	size_t length_bucket = 0;
+	for (size_t length = password_size; length >= 8 && length_bucket + 1 < metrics::length_buckets; length >>= 1) {
+		length_bucket++;
+	}
+	count_metric(METRIC_EVALUATIONS);
+	count_metric(METRIC_LENGTH_LATENCY + length_bucket * metrics::latency_buckets + latency_bucket(res.calc_time));
+
+	for (auto& phase : res.phases) {
+		for (size_t p = 0; p < metrics::phase_count; p++) {
+			if (!strcmp(phase.first, metrics::phase_names[p])) {
+				count_metric(METRIC_PHASE_LATENCY + p * metrics::latency_buckets + latency_bucket(phase.second));
+				break;
+			}
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Metrics collection
+//////////////////////////////////////////////////////////////////////////
+
+zxcppvbn::metrics::metrics()
+	: evaluations(0), common_verdict_hits(0), cache_hits(0), matches(), l33t_subs(0), regex_searches(0), bruteforce_matches(0), latency_by_length(), latency_by_phase()
+{
+}
+
+// Sum the counters of all threads
+zxcppvbn::metrics zxcppvbn::collect_metrics()
+{
+	uint64_t totals[METRIC_COUNT];
+	{
+		metrics_registry& metrics = registry();
+		std::lock_guard<std::mutex> guard(metrics.lock);
+		std::copy(metrics.retired, metrics.retired + METRIC_COUNT, totals);
+		for (metrics_slot* slot : metrics.slots) {
+			for (size_t c = 0; c < METRIC_COUNT; c++) {
+				totals[c] += slot->counters[c].load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	metrics result;
+	result.evaluations = totals[METRIC_EVALUATIONS];
+	result.common_verdict_hits = totals[METRIC_COMMON_VERDICT_HITS];
+	result.cache_hits = totals[METRIC_CACHE_HITS];
+	std::copy(totals + METRIC_MATCHES, totals + METRIC_MATCHES + metrics::pattern_count, result.matches);
+	result.l33t_subs = totals[METRIC_L33T_SUBS];
+	result.regex_searches = totals[METRIC_REGEX_SEARCHES];
+	result.bruteforce_matches = totals[METRIC_BRUTEFORCE_MATCHES];
+	std::copy(totals + METRIC_LENGTH_LATENCY, totals + METRIC_PHASE_LATENCY, &result.latency_by_length[0][0]);
+	std::copy(totals + METRIC_PHASE_LATENCY, totals + METRIC_COUNT, &result.latency_by_phase[0][0]);
+	return result;
+}
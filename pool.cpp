@@ -0,0 +1,59 @@
+#include "zxcppvbn.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+//////////////////////////////////////////////////////////////////////////
+// Worker threads
+//////////////////////////////////////////////////////////////////////////
+
+// Threads started once and shared by all parallel evaluations, they run the queued tasks in order
+struct zxcppvbn::worker_pool
+{
+	std::mutex lock;
+	std::condition_variable wake;
+	std::deque<std::function<void()>> queue;
+	std::vector<std::thread> threads;
+
+	worker_pool(size_t size)
+		: lock(), wake(), queue(), threads()
+	{
+		for (size_t t = 0; t < size; t++) {
+			threads.push_back(std::thread([this]() { run(); }));
+		}
+	}
+
+	void run()
+	{
+		for (;;) {
+			std::function<void()> task;
+			{
+				std::unique_lock<std::mutex> guard(lock);
+				wake.wait(guard, [this]() { return !queue.empty(); });
+				task = std::move(queue.front());
+				queue.pop_front();
+			}
+			task();
+		}
+	}
+};
+
+zxcppvbn::worker_pool& zxcppvbn::workers()
+{
+	// Started by the first parallel evaluation (the evaluating thread runs a matcher too) and never destroyed, the workers wait
+	// for tasks until the process exits
+	static worker_pool* pool = new worker_pool(std::max(2u, std::thread::hardware_concurrency()) - 1);
+	return *pool;
+}
+
+void zxcppvbn::run_task(std::function<void()> task)
+{
+	worker_pool& pool = workers();
+	{
+		std::lock_guard<std::mutex> guard(pool.lock);
+		pool.queue.push_back(std::move(task));
+	}
+	pool.wake.notify_one();
+}
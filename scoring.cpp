@@ -1,7 +1,7 @@
 #include "zxcppvbn.hpp"
 
+#include <algorithm>
 #include <cmath>
-#include <sstream>
 #include <limits>
 #include <numeric>
 
@@ -23,87 +23,239 @@ uint64_t zxcppvbn::nCk(uint64_t n, uint64_t k) const
 	return r;
 }
 
+// Number of ways to select at most k items out of n
+uint64_t zxcppvbn::binomial_sum(size_t n, size_t k) const
+{
+	if (n < entropy_table_size && k < entropy_table_size) {
+		return binomial_sums[n][k];
+	}
+	uint64_t r = 0;
+	for (size_t i = 0; i <= k; i++) {
+		r += nCk(n, i);
+	}
+	return r;
+}
+
 // Sum the cardinalities of the various character classes present in the password
 size_t zxcppvbn::calc_bruteforce_cardinality(const std::string& password) const
 {
-	size_t char_classes_count = char_classes_cardinality.size();
-	std::vector<bool> char_class_present(char_classes_count, false);
+	return password.empty() ? 0 : calc_bruteforce_cardinality(password, 0, password.size() - 1);
+}
 
+// Sum the cardinalities of the various character classes present in the password from the ith to the jth character
+size_t zxcppvbn::calc_bruteforce_cardinality(const std::string& password, size_t i, size_t j) const
+{
 	// Find which character classes present in the password
-	for (char ord : password) {
-		for (size_t i = 0; i < char_classes_count; i++) {
-			auto& c = char_classes_cardinality[i];
-			if (std::get<0>(c) <= ord && ord <= std::get<1>(c)) {
-				char_class_present[i] = true;
-				break;
-			}
-		}
+	uint8_t mask = 0;
+	for (size_t k = i; k <= j; k++) {
+		mask |= cardinality_classes[(uint8_t)password[k]];
 	}
-
-	// Sum the cardinalities of those character classes
-	size_t c = 0;
-	for (size_t i = 0; i < char_classes_count; i++) {
-		if (char_class_present[i]) {
-			c += std::get<2>(char_classes_cardinality[i]);
-		}
-	}
-	return c;
+	// Sum of the cardinalities of those character classes
+	return class_mask_cardinalities[mask];
 }
 
 //////////////////////////////////////////////////////////////////////////
 // Complex scoring
 //////////////////////////////////////////////////////////////////////////
 
-zxcppvbn::result zxcppvbn::minimum_entropy_match_sequence(const std::string& password, std::vector<std::unique_ptr<match>>& matches) const
+// Drop matches that cannot be part of the k lowest entropy match sequences: keep only the k lowest entropy matches of each span
+// (the first ones of equal entropy matches, as the scoring would), and skip duplicates (the same l33t word found using several
+// substitution maps) before calculating their entropy. The offsets of the matches by end position are updated as they are compacted.
+void zxcppvbn::prune_matches(std::vector<std::unique_ptr<match>>& matches, std::vector<size_t>& ends, size_t k) const
 {
-	size_t password_size = password.size();
-	if (password_size == 0) {
-		return result();
+	auto is_duplicate = [](const match& match1, const match& match2) {
+		return match1.pattern == match2.pattern && (match1.pattern == pattern::DICTIONARY || match1.pattern == pattern::L33T) &&
+		       match1.dictionary_name == match2.dictionary_name && match1.matched_word == match2.matched_word;
+	};
+
+	size_t kept = 0;
+	size_t l = 0;
+	for (size_t e = 1; e < ends.size(); e++) {
+		// the matches ending at e - 1 are in [l, ends[e]) before pruning, and in [ends[e - 1], kept) after it
+		size_t bucket_end = ends[e];
+		while (l < bucket_end) {
+			// Matches are ordered by their position, so the matches of a span are adjacent
+			size_t span_end = l + 1;
+			while (span_end < bucket_end && matches[span_end]->i == matches[l]->i) {
+				span_end++;
+			}
+
+			size_t best = l;
+			for (size_t k = l + 1; k < span_end; k++) {
+				bool duplicate = false;
+				for (size_t d = l; d < k && !duplicate; d++) {
+					duplicate = matches[d] && is_duplicate(*matches[k], *matches[d]);
+				}
+				if (duplicate) {
+					matches[k].reset();
+				} else if (calc_entropy(*matches[k]) < calc_entropy(*matches[best])) {
+					best = k;
+				}
+			}
+
+			if (k == 1) {
+				matches[kept++] = std::move(matches[best]);
+			} else {
+				size_t first = kept;
+				for (size_t d = l; d < span_end; d++) {
+					if (matches[d]) {
+						matches[kept++] = std::move(matches[d]);
+					}
+				}
+				std::stable_sort(matches.begin() + first, matches.begin() + kept, [this](const std::unique_ptr<match>& match1, const std::unique_ptr<match>& match2) {
+					return calc_entropy(*match1) < calc_entropy(*match2);
+				});
+				kept = std::min(kept, first + k);
+			}
+			l = span_end;
+		}
+		ends[e] = kept;
 	}
+	matches.resize(kept);
+}
+
+// Find the (up to) k lowest entropy match sequences of the password: for every prefix of the password, keep the k lowest entropy
+// candidates ending there, ordered by entropy. Candidates for a prefix are built by extending the (already ordered) candidates of
+// a shorter prefix by a bruteforce character or by a match, so each extension is merged in O(k) and the total is O(k * (n + m)).
+// The candidates of the whole password are at counts[n] and candidates[n * k ...].
+// Matches are ordered by their end position, the ones ending at l are in [ends[l], ends[l + 1]).
+void zxcppvbn::rank_match_sequences(const std::string& password, std::vector<std::unique_ptr<match>>& matches, const std::vector<size_t>& ends, size_t k, std::vector<candidate>& candidates, std::vector<size_t>& counts) const
+{
+	size_t password_size = password.size();
 	double bruteforce_entropy = ::log2((double)calc_bruteforce_cardinality(password));
 
-	std::vector<double> up_to_k(password_size, 0.0);        // minimum entropy up to k.
-	std::vector<int32_t> backpointers(password_size, -1);        // for the optimal sequence of matches up to k, holds the final match (match.j == k). match.pattern == unknown means the sequence ends w/ a brute-force character.
-	for (size_t k = 0; k < password_size; k++) {
-		// starting scenario to try and beat : adding a brute-force character to the minimum entropy sequence at k - 1.
-		up_to_k[k] = ((k > 0) ? up_to_k[k - 1] : 0.0) + bruteforce_entropy;
-		backpointers[k] = -1;
-		for (size_t l = 0; l < matches.size(); l++) {
-			auto& match = matches[l];
-			if (match->j == k) {
-				// see if best entropy up to i - 1 + entropy of this match is less than the current minimum at j.
-				double candidate_entropy = ((match->i > 0) ? up_to_k[match->i - 1] : 0.0) + calc_entropy(*match);
-				if (candidate_entropy < up_to_k[match->j]) {
-					up_to_k[match->j] = candidate_entropy;
-					backpointers[match->j] = l;
-				}
+	candidates.assign((password_size + 1) * k, candidate());
+	counts.assign(password_size + 1, 0);
+	std::vector<candidate> merged(k);
+	// the empty prefix
+	candidates[0] = candidate{ 0.0, -1, 0 };
+	counts[0] = 1;
+
+	// merge the candidates of a prefix extended by a step of the given entropy into the candidates of a longer prefix
+	// (on equal entropy the candidates already there come first)
+	auto extend = [&](size_t from, size_t to, double entropy, int32_t match) {
+		const candidate* previous = &candidates[from * k];
+		candidate* current = &candidates[to * k];
+		size_t c = 0, p = 0, m = 0;
+		while (m < k && (c < counts[to] || p < counts[from])) {
+			if (p == counts[from] || (c < counts[to] && current[c].entropy <= previous[p].entropy + entropy)) {
+				merged[m++] = current[c++];
+			} else {
+				merged[m++] = candidate{ previous[p].entropy + entropy, match, (uint32_t)p };
+				p++;
 			}
 		}
+		std::copy(merged.begin(), merged.begin() + m, current);
+		counts[to] = m;
+	};
+
+	for (size_t l = 0; l < password_size; l++) {
+		// starting scenario to try and beat : adding a brute-force character to the candidates of the prefix ending at l - 1.
+		extend(l, l + 1, bruteforce_entropy, -1);
+		// visit each match once, at its end position
+		for (size_t m = ends[l]; m < ends[l + 1]; m++) {
+			extend(matches[m]->i, l + 1, calc_entropy(*matches[m]), (int32_t)m);
+		}
 	}
+}
 
-	// walk backwards and decode the best sequence
-	std::vector<std::unique_ptr<match>> match_sequence;
-	int32_t k2 = password_size - 1;
-	while (k2 >= 0) {
-		if (backpointers[k2] >= 0) {
-			std::unique_ptr<match>& match = matches[backpointers[k2]];
-			k2 = match->i - 1;
-			match_sequence.push_back(std::move(match));
+// Walk backwards from the rth candidate of the whole password and list the matches of its sequence, in order
+std::vector<size_t> zxcppvbn::decode_match_sequence(const std::vector<std::unique_ptr<match>>& matches, size_t k, const std::vector<candidate>& candidates, size_t length, size_t r) const
+{
+	std::vector<size_t> match_sequence;
+	while (length > 0) {
+		const candidate& step = candidates[length * k + r];
+		if (step.match >= 0) {
+			match_sequence.push_back(step.match);
+			length = matches[step.match]->i;
 		} else {
-			k2 -= 1;
+			length -= 1;
 		}
+		r = step.previous;
 	}
 	std::reverse(match_sequence.begin(), match_sequence.end());
+	return std::move(match_sequence);
+}
+
+zxcppvbn::result zxcppvbn::minimum_entropy_match_sequence(const std::string& password, std::vector<std::unique_ptr<match>>& matches, const std::vector<size_t>& ends, phase_timer& timer) const
+{
+	if (password.empty()) {
+		return result();
+	}
+
+	std::vector<candidate> candidates;
+	std::vector<size_t> counts;
+	rank_match_sequences(password, matches, ends, 1, candidates, counts);
+
+	std::vector<std::unique_ptr<match>> match_sequence;
+	for (size_t l : decode_match_sequence(matches, 1, candidates, password.size(), 0)) {
+		match_sequence.push_back(std::move(matches[l]));
+	}
+	timer.lap("scoring");
+	result res = assemble_result(password, match_sequence);
+	timer.lap("assembly");
+	return std::move(res);
+}
+
+// The k lowest entropy match sequences, ordered by the entropy of their results (fewer if the password has less)
+std::vector<zxcppvbn::result> zxcppvbn::k_minimum_entropy_match_sequences(const std::string& password, std::vector<std::unique_ptr<match>>& matches, const std::vector<size_t>& ends, size_t k) const
+{
+	std::vector<result> results;
+	if (password.empty() || k == 0) {
+		return std::move(results);
+	}
+
+	// There are no more candidates than match sequences: cap k to their number (counted up to k) so that the candidate tables
+	// of a short password do not take k entries per position
+	std::vector<size_t> sequences(password.size() + 1, 0);
+	sequences[0] = 1;
+	for (size_t l = 0; l < password.size(); l++) {
+		size_t count = sequences[l];
+		for (size_t m = ends[l]; m < ends[l + 1]; m++) {
+			count = std::min(k, count + sequences[matches[m]->i]);
+		}
+		sequences[l + 1] = std::min(k, count);
+	}
+	k = sequences[password.size()];
+
+	std::vector<candidate> candidates;
+	std::vector<size_t> counts;
+	rank_match_sequences(password, matches, ends, k, candidates, counts);
+
+	// the sequences share matches, so each result gets its own copies
+	for (size_t r = 0; r < counts[password.size()]; r++) {
+		std::vector<std::unique_ptr<match>> match_sequence;
+		for (size_t l : decode_match_sequence(matches, k, candidates, password.size(), r)) {
+			match_sequence.push_back(std::unique_ptr<match>(new match(*matches[l])));
+		}
+		results.push_back(assemble_result(password, match_sequence));
+	}
+	// The scoring ranks bruteforce characters at the cardinality of the whole password, the results at the one of each part
+	std::stable_sort(results.begin(), results.end(), [](const result& result1, const result& result2) {
+		return result1.entropy < result2.entropy;
+	});
+	return std::move(results);
+}
+
+// Build the result of a match sequence
+zxcppvbn::result zxcppvbn::assemble_result(const std::string& password, std::vector<std::unique_ptr<match>>& match_sequence) const
+{
+	size_t password_size = password.size();
 
 	// Fill in the blanks between pattern matches with bruteforce "matches"
 	// That way the match sequence fully covers the password : match1.j == match2.i - 1 for every adjacent match1, match2.
 	auto make_bruteforce_match = [this, &password](size_t i, size_t j) -> std::unique_ptr<match> {
+		count_metric(METRIC_BRUTEFORCE_MATCHES);
 		std::unique_ptr<match> result(new match(pattern::BRUTEFORCE));
 		result->i = i;
 		result->j = j;
 		result->token = substr(password, i, j);
-		result->cardinality = calc_bruteforce_cardinality(result->token);
+		result->cardinality = calc_bruteforce_cardinality(password, i, j);
 		result->entropy = ::log2((double)::pow(result->cardinality, j - i + 1));
+		// The power overflows for long bruteforce parts
+		if (std::isinf(result->entropy)) {
+			result->entropy = (j - i + 1) * ::log2((double)result->cardinality);
+		}
 		return result;
 	};
 
@@ -131,9 +283,11 @@ zxcppvbn::result zxcppvbn::minimum_entropy_match_sequence(const std::string& pas
 	uint64_t max_seconds = std::numeric_limits<std::chrono::seconds::rep>::max();
 
 	// Assemble rest of result
-	res.password = password;
 	res.crack_time = std::chrono::seconds((crack_seconds > max_seconds ? max_seconds : crack_seconds));
-	res.crack_time_display = calc_display_time(crack_seconds);
+	if (opts.explain) {
+		res.password = password;
+		res.crack_time_display = calc_display_time(crack_seconds);
+	}
 	res.score = crack_time_to_score(crack_seconds);
 	return std::move(res);
 }
@@ -207,25 +361,27 @@ std::string zxcppvbn::calc_display_time(uint64_t seconds) const
 		return result;
 	};
 
-	std::ostringstream oss;
-
 	if (seconds < minute) {
-		oss << "instant";
+		return "instant";
 	} else if (seconds < hour) {
-		oss << fraction(minute) << " minutes";
+		return std::to_string(fraction(minute)) + " minutes";
 	} else if (seconds < day) {
-		oss << fraction(hour) << " hours";
+		return std::to_string(fraction(hour)) + " hours";
 	} else if (seconds < month) {
-		oss << fraction(day) << " days";
+		return std::to_string(fraction(day)) + " days";
 	} else if (seconds < year) {
-		oss << fraction(month) << " months";
+		return std::to_string(fraction(month)) + " months";
 	} else if (seconds < century) {
-		oss << fraction(year) << " years";
+		return std::to_string(fraction(year)) + " years";
 	} else {
-		oss << "centuries";
+		return "centuries";
 	}
+}
 
-	return oss.str();
+// Human-readable crack time of a result, for results calculated without options::explain
+std::string zxcppvbn::display_time(std::chrono::seconds crack_time) const
+{
+	return calc_display_time((uint64_t)crack_time.count());
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -237,7 +393,26 @@ double zxcppvbn::calc_entropy(match& match) const
 {
 	// Only calculate once
 	if (match.entropy <= 0.0) {
-		match.entropy = entropy_functions.at(match.pattern)(match);
+		switch (match.pattern) {
+		case pattern::DICTIONARY:
+			match.entropy = dictionary_entropy(match); break;
+		case pattern::L33T:
+			match.entropy = l33t_entropy(match); break;
+		case pattern::SPATIAL:
+			match.entropy = spatial_entropy(match); break;
+		case pattern::REPEAT:
+			match.entropy = repeat_entropy(match); break;
+		case pattern::SEQUENCE:
+			match.entropy = sequence_entropy(match); break;
+		case pattern::DIGITS:
+			match.entropy = digits_entropy(match); break;
+		case pattern::YEAR:
+			match.entropy = year_entropy(match); break;
+		case pattern::DATE:
+			match.entropy = date_entropy(match); break;
+		default:
+			break;
+		}
 	}
 	return match.entropy;
 }
@@ -245,7 +420,7 @@ double zxcppvbn::calc_entropy(match& match) const
 // Calculate entropy of non-l33t dictionary word
 double zxcppvbn::dictionary_entropy(match& match) const
 {
-	match.base_entropy = ::log2((double)match.rank);
+	match.base_entropy = ((size_t)match.rank < log2_ranks.size()) ? log2_ranks[match.rank] : ::log2((double)match.rank);
 	match.uppercase_entropy = extra_uppercase_entropy(match);
 	return match.base_entropy + match.uppercase_entropy;
 }
@@ -255,8 +430,6 @@ double zxcppvbn::extra_uppercase_entropy(const match& match) const
 {
 	const std::string& word = match.token;
 	size_t len = word.size();
-	const std::string& upper = sequences.at("upper");
-	const std::string& lower = sequences.at("lower");
 
 	// Determine casing characteristics
 	bool firstUpper = false;
@@ -266,7 +439,7 @@ double zxcppvbn::extra_uppercase_entropy(const match& match) const
 	size_t numUpper = 0;
 	size_t numLower = 0;
 	for (size_t i = 0; i < len; i++) {
-		if (upper.find(word[i]) == std::string::npos) {
+		if (word[i] < 'A' || 'Z' < word[i]) {
 			numNonUpper++;
 		} else {
 			if (i == 0) {
@@ -277,7 +450,7 @@ double zxcppvbn::extra_uppercase_entropy(const match& match) const
 			}
 			numUpper++;
 		}
-		if (lower.find(word[i]) == std::string::npos) {
+		if (word[i] < 'a' || 'z' < word[i]) {
 			numNonLower++;
 		} else {
 			numLower++;
@@ -304,11 +477,12 @@ double zxcppvbn::extra_uppercase_entropy(const match& match) const
 
 	// Otherwise calculate the number of ways to capitalize U + L uppercase + lowercase letters with U uppercase letters or less.
 	// Or, if there's more uppercase than lower (for e.g. PASSwORD), the number of ways to lowercase U+L letters with L lowercase letters or less.
-	uint64_t possibilities = 0;
-	for (size_t i = 0; i <= std::min(numUpper, numLower); i++) {
-		possibilities += nCk(numUpper + numLower, i);
+	size_t n = numUpper + numLower;
+	size_t k = std::min(numUpper, numLower);
+	if (n < entropy_table_size) {
+		return binomial_sum_entropies[n][k];
 	}
-	return ::log2((double)possibilities);
+	return ::log2((double)binomial_sum(n, k));
 }
 
 // Calculate entropy of l33t-substituted dictionary word
@@ -326,9 +500,7 @@ double zxcppvbn::extra_l33t_entropy(const match& match) const
 		size_t S = std::count(match.token.begin(), match.token.end(), it.second);
 		size_t U = std::count(match.token.begin(), match.token.end(), it.first);
 
-		for (size_t i = 0; i <= std::min(U, S); i++) {
-			possibilities += nCk(U + S, i);
-		}
+		possibilities += binomial_sum(U + S, std::min(U, S));
 	}
 
 	// corner case: return 1 bit for single-letter subs, like 4pple -> apple, instead of 0.
@@ -342,31 +514,29 @@ double zxcppvbn::extra_l33t_entropy(const match& match) const
 // Calculate entropy of a neighboring keyboard keystroke sequence
 double zxcppvbn::spatial_entropy(const match& match) const
 {
-	double s, d;
-
-	// Find matching stats
-	for (const auto& stat : graph_stats) {
-		const std::vector<std::string>& names = std::get<0>(stat.second);
-		auto it = std::find(names.begin(), names.end(), match.graph);
-		if (it != names.end()) {
-			s = std::get<2>(stat.second);
-			d = std::get<1>(stat.second);
-			break;
-		}
-	}
-
-	double possibilities = 0;
+	uint8_t type = graph_types.at(match.graph);
 	size_t L = match.token.length();
 	size_t t = match.turns;
 
-	// Estimate the number of possible patterns w/ length L or less with match.turns turns or less.
-	for (size_t i = 2; i <= L; i++) {
-		size_t possible_turns = std::min(t, i - 1);
-		for (size_t j = 1; j <= possible_turns; j++) {
-			possibilities += nCk(i - 1, j - 1) * s * ::pow(d, j);
+	double entropy;
+	if (L < entropy_table_size && t < entropy_table_size) {
+		entropy = spatial_entropies.at(type)[L * entropy_table_size + t];
+	} else {
+		// Find matching stats
+		const auto& stat = graph_stats.at(type);
+		double s = std::get<2>(stat);
+		double d = std::get<1>(stat);
+
+		// Estimate the number of possible patterns w/ length L or less with match.turns turns or less.
+		double possibilities = 0;
+		for (size_t i = 2; i <= L; i++) {
+			size_t possible_turns = std::min(t, i - 1);
+			for (size_t j = 1; j <= possible_turns; j++) {
+				possibilities += nCk(i - 1, j - 1) * s * ::pow(d, j);
+			}
 		}
+		entropy = ::log2(possibilities);
 	}
-	double entropy = ::log2(possibilities);
 
 	// Add extra entropy for shifted keys. (% instead of 5, A instead of a.)
 	// Math is similar to extra entropy from uppercase letters in dictionary matches.
@@ -374,11 +544,15 @@ double zxcppvbn::spatial_entropy(const match& match) const
 		size_t S = match.shifted_count;
 		size_t U = L - S;   // Unshifted count
 		size_t possible_shifts = std::min(S, U);
-		possibilities = 0;
-		for (size_t i = 0; i <= possible_shifts; i++) {
-			possibilities += nCk(S + U, i);
+		if (S + U < entropy_table_size) {
+			entropy += shift_entropies[S + U][possible_shifts];
+		} else {
+			double possibilities = 0;
+			for (size_t i = 0; i <= possible_shifts; i++) {
+				possibilities += nCk(S + U, i);
+			}
+			entropy += ::log2(possibilities);
 		}
-		entropy += ::log2(possibilities);
 	}
 	return entropy;
 }
@@ -421,7 +595,8 @@ double zxcppvbn::sequence_entropy(const match& match) const
 // Calculate entropy of simple digits
 double zxcppvbn::digits_entropy(const match& match) const
 {
-	return ::log2(::pow(10.0, match.token.length()));
+	size_t len = match.token.length();
+	return (len < entropy_table_size) ? digits_entropies[len] : ::log2(::pow(10.0, len));
 }
 
 const uint16_t zxcppvbn::min_year = 1900;
@@ -432,22 +607,16 @@ const uint16_t zxcppvbn::min_day = 1;
 const uint16_t zxcppvbn::max_day = 31;
 
 // Calculate entropy of year numbers
-double zxcppvbn::year_entropy(const match& match) const
+double zxcppvbn::year_entropy(const match&) const
 {
-	return ::log2((double)(max_year - min_year));
+	return year_entropy_value;
 }
 
 // Calculate entropy of dates
 double zxcppvbn::date_entropy(const match& match) const
 {
-	double entropy = 0.0;
-	if (match.year < 100) {
-		// Two-digit year
-		entropy = ::log2((double)(max_day * max_month * 100));
-	} else {
-		// Four-digit year
-		entropy = ::log2((double)(max_day * max_month * (max_year - min_year)));
-	}
+	// Two-digit or four-digit year
+	double entropy = date_entropy_values[(match.year < 100) ? 0 : 1];
 
 	if (!match.separator.empty()) {
 		// add two bits for separator selection [/,-,.,etc]
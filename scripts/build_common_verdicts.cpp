@@ -0,0 +1,167 @@
+// Precompute the verdicts of the most common passwords into ../common_verdicts.cpp
+//
+// Build it together with the library (with the common_verdicts.cpp currently in the tree), and run it from the scripts directory:
+//   build_common_verdicts [count]
+// The first count (1000 by default) passwords of ../data/common_passwords.txt whose result is a single dictionary match are kept.
+
+#include "../zxcppvbn.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+
+struct common_verdicts_builder
+{
+	typedef zxcppvbn::common_verdict common_verdict;
+
+	static uint64_t hash(const std::string& password, uint32_t seed)
+	{
+		return zxcppvbn::common_verdict_hash(password, seed);
+	}
+
+	// Hash and displace: place the largest buckets first, each with the first seed that sends all its passwords to free slots
+	static bool build_seeds(const std::vector<std::string>& passwords, std::vector<uint32_t>& seeds, std::vector<size_t>& slots)
+	{
+		size_t size = passwords.size();
+		std::vector<std::vector<size_t>> buckets(seeds.size());
+		for (size_t i = 0; i < size; i++) {
+			buckets[hash(passwords[i], 0) % seeds.size()].push_back(i);
+		}
+		std::vector<size_t> order(buckets.size());
+		for (size_t b = 0; b < order.size(); b++) {
+			order[b] = b;
+		}
+		std::stable_sort(order.begin(), order.end(), [&buckets](size_t b1, size_t b2) {
+			return buckets[b1].size() > buckets[b2].size();
+		});
+
+		std::vector<bool> used(size, false);
+		slots.assign(size, 0);
+		for (size_t b : order) {
+			if (buckets[b].empty()) {
+				break;
+			}
+			bool placed = false;
+			for (uint32_t seed = 1; seed < (1u << 24) && !placed; seed++) {
+				std::vector<size_t> candidates;
+				for (size_t i : buckets[b]) {
+					size_t slot = hash(passwords[i], seed) % size;
+					if (used[slot] || std::find(candidates.begin(), candidates.end(), slot) != candidates.end()) {
+						break;
+					}
+					candidates.push_back(slot);
+				}
+				if (candidates.size() == buckets[b].size()) {
+					for (size_t k = 0; k < candidates.size(); k++) {
+						used[candidates[k]] = true;
+						slots[candidates[k]] = buckets[b][k];
+					}
+					seeds[b] = seed;
+					placed = true;
+				}
+			}
+			if (!placed) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static std::string quote(const std::string& str)
+	{
+		std::ostringstream oss;
+		oss << '"';
+		for (char chr : str) {
+			if (chr == '"' || chr == '\\') {
+				oss << '\\' << chr;
+			} else if (chr < 0x20 || chr >= 0x7f) {
+				char buf[8];
+				sprintf(buf, "\\%03o", (uint8_t)chr);
+				oss << buf;
+			} else {
+				oss << chr;
+			}
+		}
+		oss << '"';
+		return oss.str();
+	}
+
+	static std::string number(double value)
+	{
+		char buf[32];
+		sprintf(buf, "%.17g", value);
+		return buf;
+	}
+
+	static int run(size_t count)
+	{
+#if !ZXCPPVBN_FULL_PROFILE
+		std::cerr << "the verdicts are computed by the full profile" << std::endl;
+		return 1;
+#endif
+		zxcppvbn::options opts;
+		opts.common_verdicts = false;
+		zxcppvbn estimator(opts);
+
+		std::ifstream list("../data/common_passwords.txt");
+		if (!list) {
+			std::cerr << "run this from the scripts directory" << std::endl;
+			return 1;
+		}
+		std::vector<std::string> passwords;
+		std::vector<zxcppvbn::result> results;
+		std::string line;
+		while (passwords.size() < count && std::getline(list, line)) {
+			if (!line.empty() && line.back() == '\r') {
+				line.pop_back();
+			}
+			if (line.empty() || std::find(passwords.begin(), passwords.end(), line) != passwords.end()) {
+				continue;
+			}
+			zxcppvbn::result res = estimator(line);
+			if (res.matches.size() == 1 && res.matches[0]->pattern == zxcppvbn::pattern::DICTIONARY) {
+				passwords.push_back(line);
+				results.push_back(std::move(res));
+			}
+		}
+
+		std::vector<uint32_t> seeds(passwords.size() / 4 + 1, 0);
+		std::vector<size_t> slots;
+		if (!build_seeds(passwords, seeds, slots)) {
+			std::cerr << "no perfect hash found" << std::endl;
+			return 1;
+		}
+
+		std::ofstream out("../common_verdicts.cpp");
+		out << "#include \"zxcppvbn.hpp\"\n\n";
+		out << "// Generated by scripts/build_common_verdicts.cpp, do not edit\n\n";
+		out << "// Only used by the full profile\n#if ZXCPPVBN_FULL_PROFILE\n\n";
+		out << "const size_t zxcppvbn::common_verdicts_size = " << passwords.size() << ";\n\n";
+		out << "const zxcppvbn::common_verdict zxcppvbn::common_verdicts[] = {\n";
+		for (size_t slot = 0; slot < slots.size(); slot++) {
+			const zxcppvbn::result& res = results[slots[slot]];
+			const zxcppvbn::match& match = *res.matches[0];
+			out << "\t{ " << quote(passwords[slots[slot]]) << ", " << quote(match.dictionary_name) << ", " << match.rank << ", "
+			    << number(match.base_entropy) << ", " << number(match.uppercase_entropy) << ", " << number(res.entropy) << ", "
+			    << res.crack_time.count() << ", " << res.score << " },\n";
+		}
+		out << "};\n\n";
+		out << "const size_t zxcppvbn::common_verdict_seeds_size = " << seeds.size() << ";\n\n";
+		out << "const uint32_t zxcppvbn::common_verdict_seeds[] = {";
+		for (size_t b = 0; b < seeds.size(); b++) {
+			out << (b % 16 == 0 ? "\n\t" : " ") << seeds[b] << ",";
+		}
+		out << "\n};\n\n#endif\n";
+
+		std::cout << passwords.size() << " verdicts, " << seeds.size() << " seeds" << std::endl;
+		return 0;
+	}
+};
+
+int main(int argc, char** argv)
+{
+	size_t count = (argc > 1) ? std::stoul(argv[1]) : 1000;
+	return common_verdicts_builder::run(count);
+}
@@ -129,27 +129,48 @@ def filter_short(terms):
 	'''
 	return [term for i, term in enumerate(terms) if 26**(len(term)) > i]
 
-def filter_dup(lst, lists):
+def filter_ascii(lst):
+	'''
+	removes words with accent chars etc.
+	(most accented words in the english lookup exist in the same table unaccented.)
+	'''
+	return [word for word in lst if all(ord(c) < 128 for c in word)]
+
+def better_dicts(lst, lst_names, lsts):
 	'''
-	filters lst to only include terms that don't have lower rank in another list
+	for each word of lst, the bit mask of the other dictionaries (bit n - n-th of lst_names) where the word has the same or a lower
+	rank. the full profile only keeps the words ranking lower than in any other dictionary (mask 0)
 	'''
 	max_rank = len(lst) + 1
 	dct = to_ranked_dict(lst)
-	dicts = [to_ranked_dict(l) for l in lists]
-	return [word for word in lst if all(dct[word] < dct2.get(word, max_rank) for dct2 in dicts)]
+	dicts = [to_ranked_dict(lsts[name]) if lsts[name] is not lst else {} for name in lst_names]
+	return dict((word, sum(1 << n for n, dct2 in enumerate(dicts) if dct[word] >= dct2.get(word, max_rank))) for word in lst)
 
-def filter_ascii(lst):
+def to_str(lst, lst_name, masks):
 	'''
-	removes words with accent chars etc.
-	(most accented words in the english lookup exist in the same table unaccented.)
+	each word ends with 2, or with 3 and 64 + its mask when the full profile keeps it in another dictionary
 	'''
-	return [word for word in lst if all(ord(c) < 128 for c in word)]
+	return (lst_name + '\x02') + ''.join(word + ('\x03' + chr(64 + masks[word]) if masks[word] else '\x02') for word in lst)
 
-def to_str(lst, lst_name):
-	return (lst_name + '\x02') + ('\x02'.join(lst) + '\x02')
+def compress(data):
+	compressed = StringIO.StringIO()
+	with gzip.GzipFile('', 'wb', 9, compressed, 0) as f:
+		f.write(data)
+	data = compressed.getvalue()
+	compressed.close()
+	return data
+
+def to_array(data, lst_name):
+	'''
+	one gzip member per dictionary, so that build profiles can leave dictionaries out (ZXCPPVBN_DICTIONARY_<NAME>)
+	'''
+	return '#if ZXCPPVBN_DICTIONARY_{0}\nstatic const uint8_t {1}_list[] = {{{2}}};\n#endif\n\n'.format(lst_name.upper(), lst_name, ','.join([str(ord(c)) for c in data]))
 
-def to_array(data):
-	return 'const size_t zxcppvbn::frequency_lists_size = {0};\n\nconst uint8_t zxcppvbn::frequency_lists[] = {{{1}}};\n'.format(len(data), ','.join([str(ord(c)) for c in data]))
+def to_table(lst_names):
+	table = 'const zxcppvbn::database zxcppvbn::frequency_lists[] = {\n'
+	for lst_name in lst_names:
+		table += '#if ZXCPPVBN_DICTIONARY_{0}\n\t{{ "{1}", {1}_list, sizeof({1}_list) }},\n#endif\n'.format(lst_name.upper(), lst_name)
+	return table + '\t{ nullptr, nullptr, 0 }\n};\n'
 
 def main():
 	english = get_ranked_english()
@@ -162,33 +183,26 @@ def main():
 															   surnames, male_names, female_names,
 															   passwords)]
 
-	# make dictionaries disjoint so that d1 & d2 == set() for any two dictionaries
-	all_dicts = set(tuple(l) for l in [english, surnames, male_names, female_names, passwords])
-	passwords    = filter_dup(passwords,    all_dicts - set([tuple(passwords)]))
-	male_names   = filter_dup(male_names,   all_dicts - set([tuple(male_names)]))
-	female_names = filter_dup(female_names, all_dicts - set([tuple(female_names)]))
-	surnames     = filter_dup(surnames,     all_dicts - set([tuple(surnames)]))
-	english      = filter_dup(english,      all_dicts - set([tuple(english)]))
-	
+	# make dictionaries disjoint so that d1 & d2 == set() for any two dictionaries of the full profile. the duplicates stay in the
+	# lists with the dictionaries where they rank better: the loader only drops them for the compiled-in ones, so that a build
+	# profile leaving a dictionary out still finds its words in the others
 	lsts = locals() # words are all ascii at this point
 	lst_names = 'passwords male_names female_names surnames english'.split();
-	raw = '\x01'.join([to_str(lsts[lst_name], lst_name) for lst_name in lst_names]) + '\x01\x00'
-	
-	compressed = StringIO.StringIO()
-	with gzip.GzipFile('frequency_lists', 'wb', 9, compressed) as f:
-		f.write(raw)
+	masks = dict((lst_name, better_dicts(lsts[lst_name], lst_names, lsts)) for lst_name in lst_names)
 	
 	with open('../frequency_lists.cpp', 'w') as f:
 		f.write('#include "zxcppvbn.hpp"\n\n')
-		f.write(to_array(compressed.getvalue()))
-	compressed.close()
+		for lst_name in lst_names:
+			f.write(to_array(compress(to_str(lsts[lst_name], lst_name, masks[lst_name]) + '\x01\x00'), lst_name))
+		f.write(to_table(lst_names))
 	
-	print '\nall done! totals:\n'
-	print 'passwords....', len(passwords)
-	print 'male.........', len(male_names)
-	print 'female.......', len(female_names)
-	print 'surnames.....', len(surnames)
-	print 'english......', len(english)
+	kept = dict((lst_name, sum(1 for mask in masks[lst_name].values() if not mask)) for lst_name in lst_names)
+	print '\nall done! totals (kept by the full profile):\n'
+	print 'passwords....', len(passwords), '(%d)' % kept['passwords']
+	print 'male.........', len(male_names), '(%d)' % kept['male_names']
+	print 'female.......', len(female_names), '(%d)' % kept['female_names']
+	print 'surnames.....', len(surnames), '(%d)' % kept['surnames']
+	print 'english......', len(english), '(%d)' % kept['english']
 	print
 
 if __name__ == '__main__':
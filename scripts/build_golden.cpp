@@ -0,0 +1,43 @@
+// Write the golden outputs (test/golden.txt) of a tree, built by build_golden.sh against the tree before the optimisations
+//
+//   build_golden [--data dir] [--count n] [--fuzz n] [--seed n] > golden.txt
+// The passwords are the ones of golden_passwords (test/golden.hpp), the defaults are the ones of the checked-in file.
+
+#include "zxcppvbn.hpp"
+#include "../test/golden.hpp"
+
+#include <cstring>
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+	std::string data = "data";
+	size_t count = 50;
+	size_t fuzz = 2000;
+	uint32_t seed = 20140101;
+	for (int a = 1; a < argc; a++) {
+		if (!strcmp(argv[a], "--data") && a + 1 < argc) {
+			data = argv[++a];
+		} else if (!strcmp(argv[a], "--count") && a + 1 < argc) {
+			count = std::stoul(argv[++a]);
+		} else if (!strcmp(argv[a], "--fuzz") && a + 1 < argc) {
+			fuzz = std::stoul(argv[++a]);
+		} else if (!strcmp(argv[a], "--seed") && a + 1 < argc) {
+			seed = (uint32_t)std::stoul(argv[++a]);
+		} else {
+			std::cerr << "usage: build_golden [--data dir] [--count n] [--fuzz n] [--seed n]" << std::endl;
+			return 1;
+		}
+	}
+
+	std::vector<std::string> passwords = golden_passwords(data, count, fuzz, seed);
+	if (passwords.size() == test_passwords().size() + fuzz) {
+		std::cerr << "cannot read the corpora in " << data << std::endl;
+		return 1;
+	}
+	zxcppvbn zxcvbn;
+	for (auto& password : passwords) {
+		std::cout << describe_result(password, zxcvbn(password)) << "\n";
+	}
+	return 0;
+}
@@ -0,0 +1,17 @@
+#!/bin/sh
+# Regenerate test/golden.txt from the tree before the optimisations (or from the given revision), the results the differential
+# harness and the test compare the current tree to
+#   scripts/build_golden.sh [revision]
+set -e
+cd "$(dirname "$0")/.."
+revision=${1:-a577a57}
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+git archive "$revision" | tar -x -C "$work"
+for source in "$work"/tools/tinf/*.c; do
+	${CC:-cc} -O2 -c "$source" -o "${source%.c}.o"
+done
+# The original sources only build with -fpermissive on recent compilers
+${CXX:-c++} -std=c++11 -O2 -fpermissive -w -pthread -I"$work" scripts/build_golden.cpp "$work"/*.cpp "$work"/tools/tinf/*.o -o "$work/build_golden"
+"$work/build_golden" --data data > test/golden.txt
@@ -87,25 +87,50 @@ def to_str(graph, graph_name):
 		g.append(to_str2(graph[c], c))
 	return (graph_name + '\x02') + ('\x02'.join(g) + '\x02')
 
-def to_array(data):
-	return 'const size_t zxcppvbn::adjacency_graphs_size = {0};\n\nconst uint8_t zxcppvbn::adjacency_graphs[] = {{{1}}};\n'.format(len(data), ','.join([str(ord(c)) for c in data]))
+def compress(data):
+	compressed = StringIO.StringIO()
+	with gzip.GzipFile('', 'wb', 9, compressed, 0) as f:
+		f.write(data)
+	data = compressed.getvalue()
+	compressed.close()
+	return data
+
+def to_array(data, graph_name):
+	'''
+	one gzip member per graph, so that build profiles can leave graphs out (ZXCPPVBN_GRAPH_<NAME>)
+	'''
+	return '#if ZXCPPVBN_GRAPH_{0}\nstatic const uint8_t {1}_graph[] = {{{2}}};\n#endif\n\n'.format(graph_name.upper(), graph_name, ','.join([str(ord(c)) for c in data]))
+
+def to_table(graph_names):
+	table = 'const zxcppvbn::database zxcppvbn::adjacency_graphs[] = {\n'
+	for graph_name in graph_names:
+		table += '#if ZXCPPVBN_GRAPH_{0}\n\t{{ "{1}", {1}_graph, sizeof({1}_graph) }},\n#endif\n'.format(graph_name.upper(), graph_name)
+	return table + '\t{ nullptr, nullptr, 0 }\n};\n'
+
+def to_statistics(graphs):
+	'''
+	average degree and starting positions of every graph, the keyboard entropies average them over all graphs
+	'''
+	table = '\n// Statistics of all the graphs, including the ones left out of the build, in name order\n'
+	table += 'const zxcppvbn::graph_statistics zxcppvbn::adjacency_graph_statistics[] = {\n'
+	for graph_name, graph in sorted(graphs):
+		degree = sum(len(n) for neighbors in graph.values() for n in neighbors if n) / float(len(graph))
+		table += '\t{{ "{0}", {1}, {2} }},\n'.format(graph_name, repr(degree), len(graph))
+	return table + '\t{ nullptr, 0, 0 }\n};\n'
 
 def main():
 	graph_specs = [('qwerty', (qwerty, True)),
 					('dvorak', (dvorak, True)),
 					('keypad', (keypad, False)),
 					('mac_keypad', (mac_keypad, False))]
-	
-	raw = '\x01'.join([to_str(build_graph(*args), graph_name) for graph_name, args in graph_specs]) + '\x01\x00'
-	
-	compressed = StringIO.StringIO()
-	with gzip.GzipFile('adjacency_graphs', 'wb', 9, compressed) as f:
-		f.write(raw)
+	graphs = [(graph_name, build_graph(*args)) for graph_name, args in graph_specs]
 	
 	with open('../adjacency_graphs.cpp', 'w') as f:
 		f.write('#include "zxcppvbn.hpp"\n\n')
-		f.write(to_array(compressed.getvalue()))
-	compressed.close()
+		for graph_name, graph in graphs:
+			f.write(to_array(compress(to_str(graph, graph_name) + '\x01\x00'), graph_name))
+		f.write(to_table([graph_name for graph_name, graph in graphs]))
+		f.write(to_statistics(graphs))
 
 if __name__ == '__main__':
 	if os.path.basename(os.getcwd()) != 'scripts':
@@ -0,0 +1,14 @@
+#!/bin/sh
+# Profile-guided build: instrumented build, training on the bundled corpora, optimised build
+#   scripts/pgo.sh [build directory] [extra cmake arguments...]
+set -e
+cd "$(dirname "$0")/.."
+build=${1:-build-pgo}
+[ $# -gt 0 ] && shift
+
+rm -rf "$build/pgo"
+cmake -S . -B "$build" -DCMAKE_BUILD_TYPE=Release -DZXCPPVBN_PGO=GENERATE "$@"
+cmake --build "$build" --parallel
+cmake --build "$build" --target pgo_train
+cmake -S . -B "$build" -DZXCPPVBN_PGO=USE "$@"
+cmake --build "$build" --parallel
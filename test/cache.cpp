@@ -0,0 +1,160 @@
+#include "../zxcppvbn.hpp"
+
+#include <cstdio>
+#include <string>
+
+// Checks of the verdict cache: least recently used eviction, time to live, the split of the capacity between the shards, the
+// scopes that keep estimators configured differently from sharing verdicts, and the metrics of the cached evaluations.
+//
+// usage: cache
+// Exits with 1 when any check fails.
+
+size_t failures = 0;
+
+void check(bool condition, const char* description)
+{
+	if (!condition) {
+		printf("FAILED: %s\n", description);
+		failures++;
+	}
+}
+
+zxcppvbn::verdict make_verdict(int score)
+{
+	zxcppvbn::verdict result;
+	result.entropy = score * 10.0;
+	result.crack_time = std::chrono::seconds(score);
+	result.score = score;
+	return result;
+}
+
+bool cached(zxcppvbn::cache& cache, const std::string& password, const std::string& scope = std::string())
+{
+	zxcppvbn::verdict result;
+	return cache.find(password, std::vector<std::string>(), scope, result);
+}
+
+// A single shard of two entries
+void check_lru()
+{
+	zxcppvbn::cache cache(2, std::chrono::seconds(3600), 1);
+	std::vector<std::string> none;
+	cache.insert("first", none, "", make_verdict(1));
+	cache.insert("second", none, "", make_verdict(2));
+	// using the first entry makes the second one the least recently used
+	check(cached(cache, "first"), "lru: first entry found");
+	cache.insert("third", none, "", make_verdict(3));
+	check(cached(cache, "first"), "lru: recently used entry kept");
+	check(!cached(cache, "second"), "lru: least recently used entry evicted");
+	check(cached(cache, "third"), "lru: new entry found");
+
+	// updating an entry refreshes it too
+	cache.insert("first", none, "", make_verdict(4));
+	cache.insert("fourth", none, "", make_verdict(4));
+	zxcppvbn::verdict result;
+	check(cache.find("first", none, "", result) && result.score == 4, "lru: updated entry kept with its new verdict");
+	check(!cached(cache, "third"), "lru: entry not refreshed evicted");
+
+	check(cache.hits() == 4 && cache.misses() == 2, "lru: hits and misses counted");
+	cache.clear();
+	check(!cached(cache, "first") && !cached(cache, "fourth"), "lru: clear drops all entries");
+}
+
+void check_ttl()
+{
+	zxcppvbn::cache cache(16, std::chrono::seconds(3600), 1);
+	std::vector<std::string> none;
+	cache.insert("default", none, "", make_verdict(1));
+	cache.insert("expired", none, "", make_verdict(2), std::chrono::seconds(0));
+	cache.insert("expiring", none, "", make_verdict(3), std::chrono::seconds(-1));
+	check(cached(cache, "default"), "ttl: entry with the default time to live found");
+	check(!cached(cache, "expired"), "ttl: entry without time to live expired");
+	check(!cached(cache, "expiring"), "ttl: entry with a negative time to live expired");
+	// a new verdict renews the entry
+	cache.insert("expired", none, "", make_verdict(2));
+	check(cached(cache, "expired"), "ttl: expired entry stored again");
+}
+
+void check_shards()
+{
+	// 64 entries split between 4 shards, filled far beyond their capacity
+	zxcppvbn::cache cache(64, std::chrono::seconds(3600), 4);
+	std::vector<std::string> none;
+	for (int p = 0; p < 1000; p++) {
+		cache.insert("password" + std::to_string(p), none, "", make_verdict(p % 5));
+	}
+	size_t kept = 0;
+	for (int p = 0; p < 1000; p++) {
+		kept += cached(cache, "password" + std::to_string(p)) ? 1 : 0;
+	}
+	// each shard is full and holds a quarter of the capacity
+	check(kept == 64, "shards: the capacity is split between the shards");
+
+	// the capacity of each shard is rounded up, and there is at least one shard
+	zxcppvbn::cache unsharded(3, std::chrono::seconds(3600), 0);
+	for (int p = 0; p < 10; p++) {
+		unsharded.insert("password" + std::to_string(p), none, "", make_verdict(1));
+	}
+	check(cached(unsharded, "password7") && cached(unsharded, "password8") && cached(unsharded, "password9") && !cached(unsharded, "password6"),
+		"shards: a single shard when none are requested");
+}
+
+void check_scopes()
+{
+	std::vector<std::string> none;
+	zxcppvbn::cache keys(16, std::chrono::seconds(3600), 1);
+	keys.insert("password", none, "a", make_verdict(1));
+	check(cached(keys, "password", "a") && !cached(keys, "password", "b"), "scopes: entries are only found in their scope");
+	keys.insert("password", std::vector<std::string>{ "user" }, "", make_verdict(1));
+	check(!cached(keys, "password"), "scopes: user inputs are part of the key");
+
+	// A long password is estimated differently in hardened mode, an estimator must not be served the verdict of the other one (a
+	// single shard, the shards of a 16 entries cache would only hold one entry each and the two verdicts could evict each other)
+	std::shared_ptr<zxcppvbn::cache> shared(new zxcppvbn::cache(16, std::chrono::seconds(3600), 1));
+	zxcppvbn::options full_opts;
+	full_opts.verdict_cache = shared;
+	full_opts.common_verdicts = false;
+	zxcppvbn::options hardened_opts = full_opts;
+	hardened_opts.hardened = true;
+	hardened_opts.max_length = 8;
+	zxcppvbn full(full_opts);
+	zxcppvbn hardened(hardened_opts);
+	std::string password = "qwertyuiopasdfghjkl";
+	zxcppvbn::verdict full_verdict = full.estimate(password);
+	zxcppvbn::verdict hardened_verdict = hardened.estimate(password);
+	check(full_verdict.entropy != hardened_verdict.entropy, "scopes: estimators with other options do not share verdicts");
+	check(hardened.estimate(password).entropy == hardened_verdict.entropy && full.estimate(password).entropy == full_verdict.entropy,
+		"scopes: estimators find their own verdicts");
+	check(shared->hits() == 2 && shared->misses() == 2, "scopes: verdicts served from the cache");
+}
+
+// Every call of estimate and operator() is an evaluation, the ones answered without matching are also counted by their source
+void check_metrics()
+{
+	zxcppvbn::options opts;
+	opts.verdict_cache.reset(new zxcppvbn::cache(16, std::chrono::seconds(3600), 1));
+	zxcppvbn estimator(opts);
+	zxcppvbn::metrics before = zxcppvbn::collect_metrics();
+	estimator.estimate("correcthorsebatterystaple");
+	estimator.estimate("correcthorsebatterystaple");
+	estimator("correcthorsebatterystaple");
+	estimator.estimate("password");
+	estimator("password");
+	zxcppvbn::metrics after = zxcppvbn::collect_metrics();
+	check(after.evaluations - before.evaluations == 5, "metrics: all the evaluations counted");
+	check(after.cache_hits - before.cache_hits == 1, "metrics: cache hits counted");
+#if ZXCPPVBN_FULL_PROFILE
+	check(after.common_verdict_hits - before.common_verdict_hits == 2, "metrics: precomputed verdicts counted");
+#endif
+}
+
+int main()
+{
+	check_lru();
+	check_ttl();
+	check_shards();
+	check_scopes();
+	check_metrics();
+	printf("%zu failed checks\n", failures);
+	return failures ? 1 : 0;
+}
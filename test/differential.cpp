@@ -0,0 +1,157 @@
+#include "../zxcppvbn.hpp"
+#include "../benchmark/workloads.hpp"
+#include "golden.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+// Golden-output differential harness: checks the results of the estimator (entropy, crack time, score and matches, entropies
+// compared bit for bit) against the golden file written from the tree before the optimisations (test/golden.hpp), in its default
+// configuration and in both configurations of each engine swap. Then reports the speedup of each swap on the benchmark corpora
+// and seeded random inputs.
+//
+// usage: differential [--golden file] [--data dir] [--count n] [--fuzz n] [--seed n] [--filter swap] [--show n]
+// Exits with 1 when any result differs from the golden file.
+
+// A new engine gets an option selecting the engine it replaces, and an entry here
+struct engine_swap {
+	const char* name;
+	void (*reference)(zxcppvbn::options& opts);
+	void (*optimised)(zxcppvbn::options& opts);
+};
+
+void no_change(zxcppvbn::options&)
+{
+}
+
+const engine_swap swaps[] = {
+#if ZXCPPVBN_REFERENCE_MATCHERS
+	{ "digits", [](zxcppvbn::options& opts) { opts.reference_digits = true; }, no_change },
+	{ "date_sep", [](zxcppvbn::options& opts) { opts.reference_date_sep = true; }, no_change },
+	{ "date_without_sep", [](zxcppvbn::options& opts) { opts.reference_date_without_sep = true; }, no_change },
+	{ "all_regex", [](zxcppvbn::options& opts) { opts.reference_digits = opts.reference_date_sep = opts.reference_date_without_sep = true; }, no_change },
+#endif
+	{ "common_verdicts", [](zxcppvbn::options& opts) { opts.common_verdicts = false; }, no_change },
+	{ "parallel", no_change, [](zxcppvbn::options& opts) { opts.parallel_threshold = 1; } }
+};
+
+zxcppvbn::options configure(void (*change)(zxcppvbn::options& opts))
+{
+	zxcppvbn::options opts;
+	opts.update_metrics = false;
+	change(opts);
+	return opts;
+}
+
+// Returns the number of passwords whose result differs from the golden file
+size_t check_golden(const std::string& name, const zxcppvbn::options& opts, const std::vector<std::pair<std::string, std::string>>& golden, size_t show)
+{
+	zxcppvbn estimator(opts);
+	size_t mismatches = 0;
+	for (auto& expected : golden) {
+		std::string actual = describe_result(expected.first, estimator(expected.first));
+		if (actual != expected.second && mismatches++ < show) {
+			std::cout << "  " << name << " differs on '" << expected.first << "'" << std::endl;
+			std::cout << "   golden: " << expected.second << std::endl << "   actual: " << actual << std::endl;
+		}
+	}
+	printf("%-28s %10zu %10zu\n", name.c_str(), golden.size(), mismatches);
+	return mismatches;
+}
+
+// Time the evaluations of the passwords with the reference and optimised configurations
+void time_swap(const engine_swap& swap, const std::vector<std::string>& passwords)
+{
+	zxcppvbn reference(configure(swap.reference)), optimised(configure(swap.optimised));
+	std::chrono::steady_clock::duration reference_time(0), optimised_time(0);
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (auto& password : passwords) {
+		reference(password);
+	}
+	reference_time = std::chrono::steady_clock::now() - start;
+	start = std::chrono::steady_clock::now();
+	for (auto& password : passwords) {
+		optimised(password);
+	}
+	optimised_time = std::chrono::steady_clock::now() - start;
+
+	double reference_ms = std::chrono::duration_cast<std::chrono::microseconds>(reference_time).count() / 1000.0;
+	double optimised_ms = std::chrono::duration_cast<std::chrono::microseconds>(optimised_time).count() / 1000.0;
+	printf("%-20s %10zu %14.1f %14.1f %8.2fx\n", swap.name, passwords.size(), reference_ms, optimised_ms,
+		optimised_ms > 0.0 ? reference_ms / optimised_ms : 0.0);
+}
+
+int main(int argc, char** argv)
+{
+	std::string golden_path;
+	std::string data = "data";
+	size_t count = 500;
+	size_t fuzz = 5000;
+	uint32_t seed = 20140101;
+	std::string filter;
+	size_t show = 5;
+	for (int a = 1; a < argc; a++) {
+		if (!strcmp(argv[a], "--golden") && a + 1 < argc) {
+			golden_path = argv[++a];
+		} else if (!strcmp(argv[a], "--data") && a + 1 < argc) {
+			data = argv[++a];
+		} else if (!strcmp(argv[a], "--count") && a + 1 < argc) {
+			count = std::stoul(argv[++a]);
+		} else if (!strcmp(argv[a], "--fuzz") && a + 1 < argc) {
+			fuzz = std::stoul(argv[++a]);
+		} else if (!strcmp(argv[a], "--seed") && a + 1 < argc) {
+			seed = (uint32_t)std::stoul(argv[++a]);
+		} else if (!strcmp(argv[a], "--filter") && a + 1 < argc) {
+			filter = argv[++a];
+		} else if (!strcmp(argv[a], "--show") && a + 1 < argc) {
+			show = std::stoul(argv[++a]);
+		} else {
+			std::cerr << "usage: differential [--golden file] [--data dir] [--count n] [--fuzz n] [--seed n] [--filter swap] [--show n]" << std::endl;
+			return 1;
+		}
+	}
+	auto selected = [&filter](const engine_swap& swap) {
+		return filter.empty() || std::string(swap.name).find(filter) != std::string::npos;
+	};
+
+	// Each configuration once: the default one, then the side of each swap that changes it
+	size_t mismatches = 0;
+	if (!golden_path.empty()) {
+		std::vector<std::pair<std::string, std::string>> golden = read_golden(golden_path);
+		if (golden.empty()) {
+			std::cerr << "cannot read " << golden_path << std::endl;
+			return 1;
+		}
+		printf("%-28s %10s %10s\n", "configuration", "passwords", "mismatches");
+		mismatches += check_golden("default", configure(no_change), golden, show);
+		for (auto& swap : swaps) {
+			if (selected(swap)) {
+				bool reference = swap.reference != no_change;
+				mismatches += check_golden(std::string(swap.name) + (reference ? " (reference)" : " (optimised)"),
+					configure(reference ? swap.reference : swap.optimised), golden, show);
+			}
+		}
+		printf("\n");
+	}
+
+	// Corpora (count passwords of each workload), then the random inputs
+	std::vector<std::string> passwords;
+	for (auto& load : build_workloads(data, count)) {
+		passwords.insert(passwords.end(), load.passwords.begin(), load.passwords.end());
+	}
+	std::mt19937 rng(seed);
+	std::vector<std::string> fuzzed = fuzz_passwords(rng, fuzz, read_column(data + "/common_passwords.txt", 1000, false));
+	passwords.insert(passwords.end(), fuzzed.begin(), fuzzed.end());
+	if (!passwords.empty()) {
+		printf("%-20s %10s %14s %14s %9s\n", "swap", "passwords", "reference ms", "optimised ms", "speedup");
+		for (auto& swap : swaps) {
+			if (selected(swap)) {
+				time_swap(swap, passwords);
+			}
+		}
+	}
+	return mismatches ? 1 : 0;
+}
@@ -0,0 +1,172 @@
+#ifndef ZXCPPVBN_TEST_GOLDEN_HPP
+#define ZXCPPVBN_TEST_GOLDEN_HPP
+
+// zxcppvbn.hpp is included first by the including file: the current one, or the one of the original tree for the generator
+// built by scripts/build_golden.sh
+#include "../benchmark/workloads.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Golden outputs: test/golden.txt holds the results of the tree before the optimisations for a fixed set of passwords, one line
+// each, written by scripts/build_golden.sh. The differential harness and the test compare the results of the current tree to it,
+// so only the public interface of the original class is used here.
+
+// The passwords of the test program
+inline std::vector<std::string> test_passwords()
+{
+	return {
+		"zxcvbn",
+		"qwER43@!",
+		"Tr0ub4dour & 3",
+		"correcthorsebatterystaple",
+		"coRrecth0rseba++ery9.23.2007staple$",
+
+		"D0g..................",
+		"abcdefghijk987654321",
+		"neverforget13/3/1997",
+		"1qaz2wsx3edc",
+
+		"temppass22",
+		"briansmith",
+		"briansmith4mayor",
+		"password1",
+		"viking",
+		"thx1138",
+		"ScoRpi0ns",
+		"do you know",
+
+		"ryanhunter2000",
+		"rianhunter2000",
+
+		"asdfghju7654rewq",
+		"AOEUIDHG&*()LS_",
+
+		"12345678",
+		"defghi6789",
+
+		"rosebud",
+		"Rosebud",
+		"ROSEBUD",
+		"rosebuD",
+		"ros3bud99",
+		"r0s3bud99",
+		"R0$38uD99",
+
+		"verlineVANDERMARK",
+
+		"eheuczkqyq",
+		"rWibMFACxAUGZmxhVncy",
+		"Ba9ZyWABu99[BK#6MBgbH88Tofv)vs$w"
+	};
+}
+
+// Random inputs made of runs that the matchers look for: digits and dates, l33t symbols, keyboard rows, words in mixed case
+inline std::vector<std::string> fuzz_passwords(std::mt19937& rng, size_t count, const std::vector<std::string>& words)
+{
+	static const char* alphabets[] = {
+		"0123456789", "0123456789/-._ \\", "4@8({[<3610!|1+7%2$5z", "qwertyuiopasdfghjklzxcvbnm", "1234567890-=!@#$%^&*()_+",
+		"/*-+789456123.0", "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ", "!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~"
+	};
+	std::vector<std::string> passwords;
+	for (size_t n = 0; n < count; n++) {
+		std::string password;
+		size_t length = 1 + rng() % 40;
+		while (password.size() < length) {
+			if (!words.empty() && rng() % 3 == 0) {
+				std::string word = words[rng() % words.size()];
+				for (auto& chr : word) {
+					if (rng() % 4 == 0) {
+						chr = (char)toupper(chr);
+					}
+				}
+				password += word;
+			} else {
+				const char* alphabet = alphabets[rng() % (sizeof(alphabets) / sizeof(alphabets[0]))];
+				for (size_t run = 1 + rng() % 10; run > 0; run--) {
+					password += alphabet[rng() % strlen(alphabet)];
+				}
+			}
+		}
+		passwords.push_back(password);
+	}
+	return passwords;
+}
+
+// The test passwords, count passwords of each benchmark workload, then the seeded random inputs
+inline std::vector<std::string> golden_passwords(const std::string& data, size_t count, size_t fuzz, uint32_t seed)
+{
+	std::vector<std::string> passwords = test_passwords();
+	for (auto& load : build_workloads(data, count)) {
+		passwords.insert(passwords.end(), load.passwords.begin(), load.passwords.end());
+	}
+	std::mt19937 rng(seed);
+	std::vector<std::string> fuzzed = fuzz_passwords(rng, fuzz, read_column(data + "/common_passwords.txt", 1000, false));
+	passwords.insert(passwords.end(), fuzzed.begin(), fuzzed.end());
+	return passwords;
+}
+
+// A line of the golden file: the password, entropy, crack time, score and its display, then each match of the result with its
+// entropy and the fields of its pattern, tab separated (the passwords have no tabs), entropies in hexadecimal so that equal lines
+// mean identical bits
+inline std::string describe_result(const std::string& password, const zxcppvbn::result& result)
+{
+	static const char* pattern_names[] = { "dictionary", "l33t", "spatial", "repeat", "sequence", "digits", "year", "date", "bruteforce" };
+	char buf[256];
+	snprintf(buf, sizeof(buf), "\t%a\t%lld\t%d\t", result.entropy, (long long)result.crack_time.count(), result.score);
+	std::string line = password + buf + result.crack_time_display;
+	for (auto& match : result.matches) {
+		snprintf(buf, sizeof(buf), "\t%s %zu-%zu %a", pattern_names[(size_t)match->pattern], match->i, match->j, match->entropy);
+		line += buf;
+		switch (match->pattern) {
+		case zxcppvbn::pattern::DICTIONARY:
+		case zxcppvbn::pattern::L33T:
+			snprintf(buf, sizeof(buf), " %s %d ", match->dictionary_name.c_str(), match->rank);
+			line += buf + match->matched_word;
+			if (match->pattern == zxcppvbn::pattern::L33T) {
+				line += " " + match->sub_display;
+			}
+			break;
+		case zxcppvbn::pattern::SPATIAL:
+			snprintf(buf, sizeof(buf), " %s %zu %zu", match->graph.c_str(), match->turns, match->shifted_count);
+			line += buf;
+			break;
+		case zxcppvbn::pattern::REPEAT:
+			line += std::string(" ") + match->repeated_char;
+			break;
+		case zxcppvbn::pattern::SEQUENCE:
+			snprintf(buf, sizeof(buf), " %s %zu %d", match->sequence_name.c_str(), match->sequence_space, (int)match->ascending);
+			line += buf;
+			break;
+		case zxcppvbn::pattern::DATE:
+			snprintf(buf, sizeof(buf), " %u-%u-%u", match->year, match->month, match->day);
+			line += buf + std::string(" ") + match->separator;
+			break;
+		case zxcppvbn::pattern::BRUTEFORCE:
+			snprintf(buf, sizeof(buf), " %zu", match->cardinality);
+			line += buf;
+			break;
+		default:
+			break;
+		}
+	}
+	return line;
+}
+
+// The lines of a golden file, by password in file order (empty if it cannot be read)
+inline std::vector<std::pair<std::string, std::string>> read_golden(const std::string& path)
+{
+	std::vector<std::pair<std::string, std::string>> lines;
+	std::ifstream file(path);
+	std::string line;
+	while (std::getline(file, line)) {
+		lines.push_back(std::make_pair(line.substr(0, line.find('\t')), line));
+	}
+	return lines;
+}
+
+#endif
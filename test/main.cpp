@@ -1,6 +1,9 @@
 #include "../zxcppvbn.hpp"
+#include "golden.hpp"
 
+#include <cstring>
 #include <iostream>
+#include <limits>
 
 void render_match(const zxcppvbn::match& match)
 {
@@ -66,65 +69,87 @@ void render_result(const zxcppvbn::result& result)
 	std::cout << " entropy: " << result.entropy;
 	std::cout << ", crack time: " << result.crack_time_display << " (" << result.crack_time.count() << " s)";
 	std::cout << ", score: " << result.score;
-	std::cout << ", calculation time: " << result.calc_time.count() << " ms" << std::endl;
+	std::cout << ", calculation time: " << result.calc_time.count() << " ns" << std::endl;
 	std::cout << " matches: " << std::endl;
 	for (auto& match : result.matches) {
 		render_match(*match);
 	}
 }
 
-int main()
+// Checks of k_best on the test passwords: a single result is the one of operator() bit for bit, the results are ordered by their
+// entropy, and k is capped by the number of explanations of short passwords. Returns the number of failed checks.
+size_t check_k_best(zxcppvbn& zxcvbn)
 {
-	zxcppvbn zxcvbn;
-
-	std::vector<std::string> test_passwords {
-		"zxcvbn",
-		"qwER43@!",
-		"Tr0ub4dour & 3",
-		"correcthorsebatterystaple",
-		"coRrecth0rseba++ery9.23.2007staple$",
-
-		"D0g..................",
-		"abcdefghijk987654321",
-		"neverforget13/3/1997",
-		"1qaz2wsx3edc",
-
-		"temppass22",
-		"briansmith",
-		"briansmith4mayor",
-		"password1",
-		"viking",
-		"thx1138",
-		"ScoRpi0ns",
-		"do you know",
-
-		"ryanhunter2000",
-		"rianhunter2000",
-
-		"asdfghju7654rewq",
-		"AOEUIDHG&*()LS_",
-
-		"12345678",
-		"defghi6789",
-
-		"rosebud",
-		"Rosebud",
-		"ROSEBUD",
-		"rosebuD",
-		"ros3bud99",
-		"r0s3bud99",
-		"R0$38uD99",
+	size_t failures = 0;
+	auto check = [&failures](bool condition, const std::string& description) {
+		if (!condition) {
+			std::cout << "k_best: " << description << std::endl;
+			failures++;
+		}
+	};
+	for (auto& password : test_passwords()) {
+		std::vector<zxcppvbn::result> best = zxcvbn.k_best(password, 1);
+		check(best.size() == 1 && describe_result(password, best[0]) == describe_result(password, zxcvbn(password)),
+			"the best result of '" + password + "' differs from operator()");
+		std::vector<zxcppvbn::result> results = zxcvbn.k_best(password, 10);
+		check(!results.empty() && results.size() <= 10, "'" + password + "' has not 1 to 10 results");
+		for (size_t r = 1; r < results.size(); r++) {
+			check(results[r - 1].entropy <= results[r].entropy, "the results of '" + password + "' are not ordered by entropy");
+		}
+	}
+	// the candidate tables of an uncapped k would not fit in memory
+	size_t huge = std::numeric_limits<size_t>::max() / 2;
+	check(zxcvbn.k_best("", huge).empty(), "an empty password has results");
+	try {
+		std::vector<zxcppvbn::result> results = zxcvbn.k_best("a", huge);
+		check(!results.empty() && results.size() < 10, "'a' has not 1 to 10 results");
+	} catch (const std::exception&) {
+		check(false, "k is not capped by the explanations of 'a'");
+	}
+	return failures;
+}
 
-		"verlineVANDERMARK",
+// Print the results of the test passwords, or with --golden compare them to the golden file and check k_best (exits with 1 when
+// any differs)
+int main(int argc, char** argv)
+{
+	std::string golden_path;
+	if (argc == 3 && !strcmp(argv[1], "--golden")) {
+		golden_path = argv[2];
+	} else if (argc != 1) {
+		std::cerr << "usage: test [--golden file]" << std::endl;
+		return 1;
+	}
 
-		"eheuczkqyq",
-		"rWibMFACxAUGZmxhVncy",
-		"Ba9ZyWABu99[BK#6MBgbH88Tofv)vs$w"
-	};
+	zxcppvbn zxcvbn;
+	if (golden_path.empty()) {
+		for (auto& password : test_passwords()) {
+			zxcppvbn::result result = zxcvbn(password);
+			render_result(result);
+			std::cout << std::endl;
+		}
+		return 0;
+	}
 
-	for (auto& password : test_passwords) {
-		zxcppvbn::result result = zxcvbn(password);
-		render_result(result);
-		std::cout << std::endl;
+	std::map<std::string, std::string> golden;
+	for (auto& line : read_golden(golden_path)) {
+		golden.insert(line);
 	}
-}
\ No newline at end of file
+	size_t mismatches = 0;
+	for (auto& password : test_passwords()) {
+		auto expected = golden.find(password);
+		std::string actual = describe_result(password, zxcvbn(password));
+		if (expected == golden.end()) {
+			std::cout << "no golden result for '" << password << "'" << std::endl;
+			mismatches++;
+		} else if (actual != expected->second) {
+			std::cout << "'" << password << "' differs" << std::endl;
+			std::cout << " golden: " << expected->second << std::endl << " actual: " << actual << std::endl;
+			mismatches++;
+		}
+	}
+	std::cout << test_passwords().size() << " passwords, " << mismatches << " mismatches" << std::endl;
+	size_t failures = check_k_best(zxcvbn);
+	std::cout << failures << " failed k_best checks" << std::endl;
+	return mismatches || failures ? 1 : 0;
+}
@@ -0,0 +1,117 @@
+#include "../zxcppvbn.hpp"
+#include "../benchmark/workloads.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+
+// Checks that a build profile leaving dictionaries out keeps the words of the others: test/common_ranks.txt holds the dictionary
+// and rank of the most common passwords in the full profile. Each one keeps its rank when its dictionary is compiled in, and is
+// otherwise still a word of another dictionary.
+//
+// usage: profile [--ranks file] [--write] [--data dir] [--count n]
+// --write rewrites the ranks file from the count most common passwords, with a full profile build.
+// Exits with 1 when any check fails.
+
+// Dictionaries of the build profile
+const std::set<std::string> compiled_dictionaries = {
+#if ZXCPPVBN_DICTIONARY_PASSWORDS
+	"passwords",
+#endif
+#if ZXCPPVBN_DICTIONARY_MALE_NAMES
+	"male_names",
+#endif
+#if ZXCPPVBN_DICTIONARY_FEMALE_NAMES
+	"female_names",
+#endif
+#if ZXCPPVBN_DICTIONARY_SURNAMES
+	"surnames",
+#endif
+#if ZXCPPVBN_DICTIONARY_ENGLISH
+	"english",
+#endif
+};
+
+struct profile_check
+{
+	// The dictionary with the lowest rank of the word and its rank (none and 0 when no dictionary has the word)
+	static std::pair<std::string, int> find_word(const zxcppvbn& estimator, const std::string& word)
+	{
+		std::pair<std::string, int> best(std::string(), 0);
+		for (auto& dict : estimator.ranked_dictionaries) {
+			auto found = dict.second.find(word);
+			if (found != dict.second.end() && (!best.second || found->second < best.second)) {
+				best = std::make_pair(dict.first, found->second);
+			}
+		}
+		return best;
+	}
+};
+
+int main(int argc, char** argv)
+{
+	std::string ranks_path = "test/common_ranks.txt";
+	bool write = false;
+	std::string data = "data";
+	size_t count = 2000;
+	for (int a = 1; a < argc; a++) {
+		if (!strcmp(argv[a], "--ranks") && a + 1 < argc) {
+			ranks_path = argv[++a];
+		} else if (!strcmp(argv[a], "--write")) {
+			write = true;
+		} else if (!strcmp(argv[a], "--data") && a + 1 < argc) {
+			data = argv[++a];
+		} else if (!strcmp(argv[a], "--count") && a + 1 < argc) {
+			count = std::stoul(argv[++a]);
+		} else {
+			std::cerr << "usage: profile [--ranks file] [--write] [--data dir] [--count n]" << std::endl;
+			return 1;
+		}
+	}
+	zxcppvbn estimator;
+
+	if (write) {
+		if (!ZXCPPVBN_FULL_PROFILE) {
+			std::cerr << "the ranks are written by a full profile build" << std::endl;
+			return 1;
+		}
+		std::ofstream ranks(ranks_path);
+		for (auto& password : read_column(data + "/common_passwords.txt", count, false)) {
+			std::pair<std::string, int> word = profile_check::find_word(estimator, password);
+			if (word.second) {
+				ranks << password << "\t" << word.first << "\t" << word.second << std::endl;
+			}
+		}
+		return ranks ? 0 : 1;
+	}
+
+	std::ifstream ranks(ranks_path);
+	std::string line;
+	size_t checked = 0, failures = 0;
+	while (std::getline(ranks, line)) {
+		std::istringstream fields(line);
+		std::string password, dictionary;
+		int rank = 0;
+		std::getline(fields, password, '\t');
+		fields >> dictionary >> rank;
+		std::pair<std::string, int> word = profile_check::find_word(estimator, password);
+		if (!word.second) {
+			printf("FAILED: '%s' is in no dictionary (%s %d in the full profile)\n", password.c_str(), dictionary.c_str(), rank);
+			failures++;
+		} else if (compiled_dictionaries.count(dictionary) && word != std::make_pair(dictionary, rank)) {
+			printf("FAILED: '%s' is %s %d instead of %s %d\n", password.c_str(), word.first.c_str(), word.second, dictionary.c_str(), rank);
+			failures++;
+		}
+		checked++;
+	}
+	if (!checked) {
+		std::cerr << "cannot read " << ranks_path << std::endl;
+		return 1;
+	}
+	printf("%zu common passwords, %zu failed checks\n", checked, failures);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,173 @@
+#include "zxcppvbn.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <ostream>
+
+//////////////////////////////////////////////////////////////////////////
+// Trace storage
+//////////////////////////////////////////////////////////////////////////
+
+std::atomic<bool> zxcppvbn::tracing(false);
+
+// Ring buffer of the last events of a thread, its lock is only contended while the trace is restarted or written
+struct zxcppvbn::trace_buffer
+{
+	// Complete event (an interval), the names are string literals
+	struct event {
+		const char* name;
+		uint32_t thread;
+		int64_t length;         // password length of an evaluation, -1 for the other events
+		std::chrono::steady_clock::time_point begin;
+		std::chrono::steady_clock::time_point end;
+	};
+
+	std::mutex lock;
+	uint32_t thread;            // trace id of the thread owning the buffer
+	size_t capacity;
+	std::vector<event> events;
+	size_t next;                // oldest event, overwritten first once the buffer is full
+
+	trace_buffer()
+		: lock(), thread(0), capacity(0), events(), next(0)
+	{
+	}
+
+	void push(const event& e)
+	{
+		if (events.size() < capacity) {
+			events.push_back(e);
+		} else if (capacity > 0) {
+			events[next] = e;
+			next = (next + 1) % capacity;
+		}
+	}
+
+	void reset(size_t events_per_thread)
+	{
+		capacity = events_per_thread;
+		events.clear();
+		next = 0;
+	}
+};
+
+// All the buffers, the ones of exited threads are handed to new threads (keeping their events until they are overwritten), so
+// threads that come and go do not add buffers (the workers of parallel evaluations are persistent, see pool.cpp)
+struct zxcppvbn::trace_registry
+{
+	std::mutex lock;
+	std::vector<std::unique_ptr<trace_buffer>> buffers;
+	std::vector<trace_buffer*> free_buffers;
+	size_t capacity;
+	uint32_t last_thread;
+
+	trace_registry()
+		: lock(), buffers(), free_buffers(), capacity(0), last_thread(0)
+	{
+	}
+};
+
+zxcppvbn::trace_registry& zxcppvbn::tracer()
+{
+	// Never destroyed, threads may still exit after the static destructors ran
+	static trace_registry* registry = new trace_registry();
+	return *registry;
+}
+
+// The buffer of the calling thread, taken on first use and given back when the thread exits
+zxcppvbn::trace_buffer& zxcppvbn::local_trace_buffer()
+{
+	struct owner {
+		trace_buffer* buffer;
+
+		owner()
+			: buffer(nullptr)
+		{
+			trace_registry& trace = tracer();
+			std::lock_guard<std::mutex> guard(trace.lock);
+			if (trace.free_buffers.empty()) {
+				trace.buffers.emplace_back(new trace_buffer());
+				buffer = trace.buffers.back().get();
+				buffer->capacity = trace.capacity;
+			} else {
+				buffer = trace.free_buffers.back();
+				trace.free_buffers.pop_back();
+			}
+			std::lock_guard<std::mutex> buffer_guard(buffer->lock);
+			buffer->thread = ++trace.last_thread;
+		}
+
+		~owner()
+		{
+			trace_registry& trace = tracer();
+			std::lock_guard<std::mutex> guard(trace.lock);
+			trace.free_buffers.push_back(buffer);
+		}
+	};
+	static thread_local owner local;
+	return *local.buffer;
+}
+
+void zxcppvbn::trace_event(const char* name, std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end, int64_t length /* = -1 */)
+{
+	trace_buffer& buffer = local_trace_buffer();
+	std::lock_guard<std::mutex> guard(buffer.lock);
+	trace_buffer::event e = { name, buffer.thread, length, begin, end };
+	buffer.push(e);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Trace control
+//////////////////////////////////////////////////////////////////////////
+
+// Drop the events recorded so far and start recording
+void zxcppvbn::start_tracing(size_t events_per_thread /* = 16384 */)
+{
+	trace_registry& trace = tracer();
+	std::lock_guard<std::mutex> guard(trace.lock);
+	trace.capacity = events_per_thread;
+	for (auto& buffer : trace.buffers) {
+		std::lock_guard<std::mutex> buffer_guard(buffer->lock);
+		buffer->reset(events_per_thread);
+	}
+	tracing.store(true, std::memory_order_relaxed);
+}
+
+// Stop recording, the events are kept until the next start_tracing (evaluations already running finish their events)
+void zxcppvbn::stop_tracing()
+{
+	tracing.store(false, std::memory_order_relaxed);
+}
+
+// Write the recorded events of all threads in the Chrome trace event format, as complete ("X") events in microseconds from the
+// first one
+void zxcppvbn::write_trace(std::ostream& out)
+{
+	std::vector<trace_buffer::event> events;
+	{
+		trace_registry& trace = tracer();
+		std::lock_guard<std::mutex> guard(trace.lock);
+		for (auto& buffer : trace.buffers) {
+			std::lock_guard<std::mutex> buffer_guard(buffer->lock);
+			events.insert(events.end(), buffer->events.begin(), buffer->events.end());
+		}
+	}
+	// Enclosing events first
+	std::sort(events.begin(), events.end(), [](const trace_buffer::event& e1, const trace_buffer::event& e2) {
+		return (e1.begin < e2.begin) || (e1.begin == e2.begin && e1.end > e2.end);
+	});
+
+	out << "{\"traceEvents\":[";
+	for (size_t e = 0; e < events.size(); e++) {
+		double ts = std::chrono::duration_cast<std::chrono::nanoseconds>(events[e].begin - events[0].begin).count() / 1000.0;
+		double dur = std::chrono::duration_cast<std::chrono::nanoseconds>(events[e].end - events[e].begin).count() / 1000.0;
+		char buf[96];
+		snprintf(buf, sizeof(buf), "\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f", events[e].thread, ts, dur);
+		out << (e ? ",\n" : "\n") << "{\"name\":\"" << events[e].name << "\",\"cat\":\"zxcppvbn\"," << buf;
+		if (events[e].length >= 0) {
+			out << ",\"args\":{\"length\":" << events[e].length << "}";
+		}
+		out << "}";
+	}
+	out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
@@ -3,12 +3,72 @@
 
 #include <cstdint>
 #include <memory>
-#include <functional>
 #include <string>
 #include <map>
 #include <vector>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+#include <iosfwd>
+
+// Build profile: the dictionaries and keyboard graphs compiled in (each one unless defined to 0, e.g. -DZXCPPVBN_DICTIONARY_ENGLISH=0),
+// the std::regex based reference matchers (ZXCPPVBN_REFERENCE_MATCHERS, the reference_* options have no effect without them),
+// and the matcher pipeline (ZXCPPVBN_MATCHERS, see below). ZXCPPVBN_PROFILE_MINIMAL defaults to the passwords and first names
+// dictionaries, the qwerty and keypad graphs, and no reference matchers.
+#ifdef ZXCPPVBN_PROFILE_MINIMAL
+#define ZXCPPVBN_PROFILE_DEFAULT 0
+#else
+#define ZXCPPVBN_PROFILE_DEFAULT 1
+#endif
+#ifndef ZXCPPVBN_DICTIONARY_PASSWORDS
+#define ZXCPPVBN_DICTIONARY_PASSWORDS 1
+#endif
+#ifndef ZXCPPVBN_DICTIONARY_MALE_NAMES
+#define ZXCPPVBN_DICTIONARY_MALE_NAMES 1
+#endif
+#ifndef ZXCPPVBN_DICTIONARY_FEMALE_NAMES
+#define ZXCPPVBN_DICTIONARY_FEMALE_NAMES 1
+#endif
+#ifndef ZXCPPVBN_DICTIONARY_SURNAMES
+#define ZXCPPVBN_DICTIONARY_SURNAMES ZXCPPVBN_PROFILE_DEFAULT
+#endif
+#ifndef ZXCPPVBN_DICTIONARY_ENGLISH
+#define ZXCPPVBN_DICTIONARY_ENGLISH ZXCPPVBN_PROFILE_DEFAULT
+#endif
+#ifndef ZXCPPVBN_GRAPH_QWERTY
+#define ZXCPPVBN_GRAPH_QWERTY 1
+#endif
+#ifndef ZXCPPVBN_GRAPH_DVORAK
+#define ZXCPPVBN_GRAPH_DVORAK ZXCPPVBN_PROFILE_DEFAULT
+#endif
+#ifndef ZXCPPVBN_GRAPH_KEYPAD
+#define ZXCPPVBN_GRAPH_KEYPAD 1
+#endif
+#ifndef ZXCPPVBN_GRAPH_MAC_KEYPAD
+#define ZXCPPVBN_GRAPH_MAC_KEYPAD ZXCPPVBN_PROFILE_DEFAULT
+#endif
+#ifndef ZXCPPVBN_REFERENCE_MATCHERS
+#define ZXCPPVBN_REFERENCE_MATCHERS ZXCPPVBN_PROFILE_DEFAULT
+#endif
+
+// Whether everything that changes the results is compiled in (the precomputed verdicts are only valid then)
+#if ZXCPPVBN_DICTIONARY_PASSWORDS && ZXCPPVBN_DICTIONARY_MALE_NAMES && ZXCPPVBN_DICTIONARY_FEMALE_NAMES && ZXCPPVBN_DICTIONARY_SURNAMES && \
+	ZXCPPVBN_DICTIONARY_ENGLISH && ZXCPPVBN_GRAPH_QWERTY && ZXCPPVBN_GRAPH_DVORAK && ZXCPPVBN_GRAPH_KEYPAD && ZXCPPVBN_GRAPH_MAC_KEYPAD && \
+	!defined(ZXCPPVBN_MATCHERS)
+#define ZXCPPVBN_FULL_PROFILE 1
+#else
+#define ZXCPPVBN_FULL_PROFILE 0
+#endif
+
+#if ZXCPPVBN_REFERENCE_MATCHERS
 #include <regex>
+#endif
 
 // Password estimation, implemented entirely in one class
 class zxcppvbn
@@ -30,7 +90,7 @@ public:
 
 	// Submatch
 	struct match {
-		pattern pattern;
+		zxcppvbn::pattern pattern;
 		size_t i;
 		size_t j;
 		std::string token;
@@ -73,6 +133,18 @@ public:
 		match(zxcppvbn::pattern p);
 	};
 
+	// Time spent in each phase of an evaluation, in order
+	typedef std::vector<std::pair<const char* /* phase */, std::chrono::nanoseconds>> phase_times;
+
+	// Heap allocations of an evaluation, with the ones of its matchers run on worker threads (counted when the library is built
+	// with ZXCPPVBN_ALLOC_ACCOUNTING, see alloc.cpp)
+	struct allocation_stats {
+		uint64_t allocations;
+		uint64_t bytes;
+		uint64_t peak_bytes;    // highest amount of live memory allocated since the start
+	};
+	typedef std::vector<std::pair<const char* /* phase */, allocation_stats>> allocation_phases;
+
 	// Password estimation result
 	struct result {
 		std::string password;
@@ -81,7 +153,12 @@ public:
 		std::string crack_time_display;
 		int score;
 		std::vector<std::unique_ptr<match>> matches;
-		std::chrono::milliseconds calc_time;
+		std::chrono::nanoseconds calc_time;
+		// Only filled with options::phase_timings
+		phase_times phases;
+		// Only filled when built with ZXCPPVBN_ALLOC_ACCOUNTING
+		allocation_stats allocations;
+		allocation_phases phase_allocations;
 
 		result();
 		result(const result& o);
@@ -90,44 +167,344 @@ public:
 		result& operator=(result && o);
 	};
 
+	// Numeric verdict of an evaluation
+	struct verdict {
+		double entropy;
+		std::chrono::seconds crack_time;
+		int score;
+	};
+
+	// Bounded LRU cache of verdicts, safe to share between threads and estimators (cache.cpp)
+	// Entries are keyed by a keyed hash (SipHash-2-4 with a random key) of the password, the user inputs and the scope (the settings
+	// of the estimator that change verdicts, so that estimators configured differently do not share entries), so neither the
+	// password nor the user inputs are retained, and expire after their time to live.
+	class cache
+	{
+	public:
+		cache(size_t capacity, std::chrono::seconds ttl, size_t shards = 16);
+
+		bool find(const std::string& password, const std::vector<std::string>& user_inputs, const std::string& scope, verdict& result);
+		void insert(const std::string& password, const std::vector<std::string>& user_inputs, const std::string& scope, const verdict& result);
+		void insert(const std::string& password, const std::vector<std::string>& user_inputs, const std::string& scope, const verdict& result, std::chrono::seconds ttl);
+		void clear();
+
+		uint64_t hits() const;
+		uint64_t misses() const;
+
+	private:
+		struct entry {
+			uint64_t key;
+			verdict result;
+			std::chrono::steady_clock::time_point expiry;
+		};
+		// Each shard is an independent LRU list (most recently used first), with its own lock
+		struct shard {
+			std::mutex lock;
+			std::list<entry> lru;
+			std::unordered_map<uint64_t /* key */, std::list<entry>::iterator> index;
+		};
+
+		uint64_t sip_key[2];
+		size_t shard_capacity;
+		std::chrono::seconds ttl;
+		std::vector<std::unique_ptr<shard>> shards;
+		std::atomic<uint64_t> hit_count;
+		std::atomic<uint64_t> miss_count;
+
+		uint64_t hash(const std::string& password, const std::vector<std::string>& user_inputs, const std::string& scope) const;
+		static uint64_t siphash(const uint64_t key[2], const uint8_t* data, size_t size);
+		shard& shard_of(uint64_t key);
+	};
+
+	// Process-wide operational counters of all estimators, aggregated over all threads when collected (metrics.cpp)
+	struct metrics {
+		static const size_t pattern_count = (size_t)pattern::BRUTEFORCE + 1;
+		static const size_t latency_buckets = 40;       // bucket k counts latencies of [2^k, 2^(k + 1)) ns (the first one from 0)
+		static const size_t length_buckets = 6;         // passwords of [0, 8), [8, 16), [16, 32), [32, 64), [64, 128) and 128 or more characters
+		static const size_t phase_count = 18;
+		static const char* const phase_names[phase_count];
+
+		uint64_t evaluations;                           // calls of operator(), estimate and k_best, however they were answered
+		uint64_t common_verdict_hits;                   // evaluations answered from the precomputed verdicts
+		uint64_t cache_hits;                            // evaluations answered from options::verdict_cache
+		uint64_t matches[pattern_count];                // found by the matchers, by pattern
+		uint64_t l33t_subs;                             // l33t substitution maps enumerated
+		uint64_t regex_searches;                        // by the std::regex based (reference) matchers
+		uint64_t bruteforce_matches;                    // bruteforce parts of the results
+		uint64_t latency_by_length[length_buckets][latency_buckets];   // only evaluations of operator()
+		uint64_t latency_by_phase[phase_count][latency_buckets];   // only evaluations with options::phase_timings
+
+		metrics();
+	};
+	static metrics collect_metrics();
+
+	// Process-wide tracing of evaluations (trace.cpp): while enabled, each thread keeps its last events_per_thread events (the
+	// evaluations and their phases, the matchers of parallel evaluations on their worker threads) in a ring buffer, which
+	// write_trace dumps as Chrome trace event JSON (chrome://tracing, ui.perfetto.dev)
+	static void start_tracing(size_t events_per_thread = 16384);
+	static void stop_tracing();
+	static void write_trace(std::ostream& out);
+
+	// Estimator options
+	struct options {
+		// Use the original std::regex based digit and year matchers (reference backend for testing)
+		bool reference_digits;
+		// Use the original std::regex based matcher for dates with separators
+		bool reference_date_sep;
+		// Use the original std::regex and string based matcher for dates without separators
+		bool reference_date_without_sep;
+		// Run the matchers concurrently for passwords of at least this length (0 - always run serially)
+		size_t parallel_threshold;
+		// Hardened mode for untrusted input: only the first max_length characters are matched and scored, the rest of the password
+		// is estimated as bruteforce in a single pass, and at most max_l33t_subs l33t substitution maps are tried (the l33t table
+		// yields up to 8 maps, the default 4 halves the worst case). With p = min(n, max_length) for an n character password,
+		// S = max_l33t_subs, K dictionaries, L - longest dictionary word and D - largest dictionary size, the dictionary and l33t
+		// matchers probe (1 + S) * K * p * L substrings, each one copied (O(L)) and looked up (O(L * log D)): the work is then
+		// O((1 + S) * K * p * L^2 * log D) for matching, O(m log m) for sorting the m matches of the prefix by position, O(p + m)
+		// for scoring them and O(n) for the rest.
+		bool hardened;
+		size_t max_length;
+		size_t max_l33t_subs;
+		// Fill the human-readable fields (password and crack_time_display of the result, sub_display of l33t matches),
+		// when disabled they are left empty and display_time can format the crack time on demand
+		bool explain;
+		// Record the time spent in each phase of operator() in result::phases (user inputs, prescan, each matcher, sort, pruning,
+		// scoring, assembly), off by default so that evaluations do not read the clock more than twice
+		bool phase_timings;
+		// Verdicts of estimate are looked up in and stored to this cache (none by default), it may be shared by several estimators
+		std::shared_ptr<cache> verdict_cache;
+		// Update the process-wide metrics
+		bool update_metrics;
+		// Answer the most common passwords from the table precomputed by scripts/build_common_verdicts.cpp (when there are no user inputs)
+		bool common_verdicts;
+
+		options();
+	};
+
 private:
-	// Compressed databases (frequency_lists.cpp, adjacency_graphs.cpp)
-	static const uint8_t frequency_lists[];
-	static const size_t frequency_lists_size;
-	static const uint8_t adjacency_graphs[];
-	static const size_t adjacency_graphs_size;
+	// Tools built on the internals (scripts/build_common_verdicts.cpp, benchmark/matchers.cpp, test/profile.cpp)
+	friend struct common_verdicts_builder;
+	friend struct matcher_profiler;
+	friend struct profile_check;
+
+	// Options given at construction
+	options opts;
+	// Options and build profile that change the verdicts, the scope of the entries of options::verdict_cache
+	std::string cache_scope;
+
+	// Compressed databases, one per dictionary and keyboard graph of the build profile, up to a null name (frequency_lists.cpp,
+	// adjacency_graphs.cpp)
+	struct database {
+		const char* name;
+		const uint8_t* data;
+		size_t size;
+	};
+	static const database frequency_lists[];
+	static const database adjacency_graphs[];
+	// Statistics of all the keyboard graphs, the ones left out of the build included, so that the spatial entropies do not
+	// depend on the profile
+	struct graph_statistics {
+		const char* name;
+		double average_degree;
+		double starting_positions;
+	};
+	static const graph_statistics adjacency_graph_statistics[];
+
+	// Precomputed verdicts of the most common passwords, each one a single dictionary match (common_verdicts.cpp)
+	// The table is a minimal perfect hash: the bucket of a password gives the seed of its hash in the table.
+	struct common_verdict {
+		const char* password;
+		const char* dictionary_name;
+		int rank;
+		double base_entropy;
+		double uppercase_entropy;
+		double entropy;
+		int64_t crack_time;
+		int score;
+	};
+	static const common_verdict common_verdicts[];
+	static const size_t common_verdicts_size;
+	static const uint32_t common_verdict_seeds[];
+	static const size_t common_verdict_seeds_size;
 
 	// Databases
 	std::map<std::string /* dictionary name */, std::map<std::string /* word */, int /* rank */>> ranked_dictionaries;
+	std::map<std::string /* dictionary name */, size_t /* longest word length */> dictionary_max_lengths;
 	std::map<std::string /* keyboard name */, std::map<char /* key */, std::vector<std::string /* keys */> /* neigbors */>> graphs;
 	std::map<uint8_t /* keyboard type */, std::tuple<std::vector<std::string> /* keyboard names */, double /* average degree */, double /* starting positions */>> graph_stats;
 	std::map<char /* original */, std::vector<char /* l33t */>> l33t_table;
 	std::map<std::string /* sequence name */, std::string /* sequence chars */> sequences;
 	std::vector<std::tuple<char /* min */, char /* max */, size_t /* cardinality */>> char_classes_cardinality;
+	uint8_t cardinality_classes[256];                                   // bit of the first matching character class by character (0 - none)
+	std::vector<size_t /* cardinality */> class_mask_cardinalities;     // by bit mask of present character classes
+	uint8_t daymonth_table[100 /* month */][100 /* day */];   // 0 - invalid, 1 - valid, 2 - valid with day and month swapped
+
+	// Character classes, used to skip matchers that cannot find anything in the password
+	enum char_class : uint8_t
+	{
+		CHAR_DIGIT = 0x01,
+		CHAR_LETTER = 0x02,
+		CHAR_ALPHANUMERIC = 0x04,
+		CHAR_L33T = 0x08,
+		CHAR_SEPARATOR = 0x10,
+		CHAR_KEYPAD = 0x20
+	};
+	uint8_t char_classes[256];
+
+	// Entropy lookup tables (for lengths and counts under entropy_table_size)
+	static const size_t entropy_table_size = 64;
+	std::vector<double> log2_ranks;                                                 // log2(rank) by rank
+	uint64_t binomial_sums[entropy_table_size][entropy_table_size];                 // sum of nCk(n, i) for i <= k by n and k
+	double binomial_sum_entropies[entropy_table_size][entropy_table_size];          // log2 of the sums above by n and k
+	double shift_entropies[entropy_table_size][entropy_table_size];                 // the same, summed as double (for shifted keys) by n and k
+	std::map<std::string /* keyboard name */, uint8_t /* keyboard type */> graph_types;
+	std::map<uint8_t /* keyboard type */, std::vector<double> /* entropy by length and turns */> spatial_entropies;
+	double digits_entropies[entropy_table_size];                                    // by length
+	double year_entropy_value;
+	double date_entropy_values[2];                                                  // two-digit and four-digit years
+
+	// Process-wide metrics, each thread updates its own cache line padded counters without locking (metrics.cpp)
+	enum metric : size_t
+	{
+		METRIC_EVALUATIONS,
+		METRIC_COMMON_VERDICT_HITS,
+		METRIC_CACHE_HITS,
+		METRIC_MATCHES,
+		METRIC_L33T_SUBS = METRIC_MATCHES + metrics::pattern_count,
+		METRIC_REGEX_SEARCHES,
+		METRIC_BRUTEFORCE_MATCHES,
+		METRIC_LENGTH_LATENCY,
+		METRIC_PHASE_LATENCY = METRIC_LENGTH_LATENCY + metrics::length_buckets * metrics::latency_buckets,
+		METRIC_COUNT = METRIC_PHASE_LATENCY + metrics::phase_count * metrics::latency_buckets
+	};
+	struct metrics_slot;
+	struct metrics_registry;
+	static metrics_registry& registry();
+	static metrics_slot& local_metrics_slot();
+	void count_metric(size_t metric, uint64_t count = 1) const;
+	void record_latency_metrics(size_t password_size, const result& res) const;
+
+	// Tracing, each thread appends to its own ring buffer (trace.cpp)
+	struct trace_buffer;
+	struct trace_registry;
+	static std::atomic<bool> tracing;
+	static trace_registry& tracer();
+	static trace_buffer& local_trace_buffer();
+	static void trace_event(const char* name, std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end, int64_t length = -1);
 
 	// Function prototypes
-	typedef std::function<std::vector<std::unique_ptr<match>>(const std::string&)> matcher_func;
-	typedef std::function<double(match&)> entropy_func;
+	// (matchers get the password and the character classes found in it by omnimatch)
+	typedef std::vector<std::unique_ptr<match>> (zxcppvbn::*matcher_func)(const std::string&, uint8_t) const;
 
-	// Function maps
-	std::vector<matcher_func> dictionary_matchers;
-	std::vector<matcher_func> matchers;
-	std::map<pattern, entropy_func> entropy_functions;
+	// Worker threads shared by the parallel evaluations, started on first use (pool.cpp)
+	struct worker_pool;
+	static worker_pool& workers();
+	static void run_task(std::function<void()> task);
+
+	// Allocation counting of the calling thread, scopes nest (alloc.cpp, only defined with ZXCPPVBN_ALLOC_ACCOUNTING)
+	struct allocation_scope {
+		uint64_t allocations;
+		uint64_t bytes;
+		int64_t live_bytes;
+		int64_t saved_peak_bytes;
+	};
+	static allocation_scope begin_allocations();
+	static allocation_stats end_allocations(const allocation_scope& scope);
+	// The tasks of parallel evaluations hand their allocations over to the evaluating thread
+	static allocation_stats end_task_allocations(const allocation_scope& scope, int64_t& live_bytes);
+	static void add_task_allocations(const allocation_stats& stats, int64_t live_bytes);
+
+	// Records the time and the allocations since the previous lap for each phase, and traces the phases while tracing is enabled,
+	// does not read the clock when there is nowhere to record it (the allocations are only recorded when built with
+	// ZXCPPVBN_ALLOC_ACCOUNTING)
+	struct phase_timer {
+		phase_times* times;
+		bool traced;
+		std::chrono::steady_clock::time_point last;
+		allocation_phases* allocations;
+		allocation_scope total_scope;
+		allocation_scope phase_scope;
+
+		phase_timer(phase_times* times, allocation_phases* allocations = nullptr)
+			: times(times), traced(tracing.load(std::memory_order_relaxed)),
+			  last((times || traced) ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point()), allocations(allocations),
+			  total_scope(), phase_scope()
+		{
+#ifdef ZXCPPVBN_ALLOC_ACCOUNTING
+			if (allocations) {
+				total_scope = begin_allocations();
+				phase_scope = begin_allocations();
+			}
+#endif
+		}
+
+		bool enabled() const
+		{
+			return times || traced || allocations;
+		}
+
+		void lap(const char* phase)
+		{
+			if (times || traced) {
+				std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+				if (times) {
+					times->push_back(std::make_pair(phase, std::chrono::duration_cast<std::chrono::nanoseconds>(now - last)));
+				}
+				if (traced) {
+					trace_event(phase, last, now);
+				}
+				last = now;
+			}
+#ifdef ZXCPPVBN_ALLOC_ACCOUNTING
+			if (allocations) {
+				allocation_stats stats = end_allocations(phase_scope);
+				allocations->push_back(std::make_pair(phase, stats));
+				phase_scope = begin_allocations();
+			}
+#endif
+		}
+
+		// Allocations since the timer started, ends the recording
+		allocation_stats total()
+		{
+			allocation_stats stats = allocation_stats();
+#ifdef ZXCPPVBN_ALLOC_ACCOUNTING
+			if (allocations) {
+				end_allocations(phase_scope);
+				stats = end_allocations(total_scope);
+				allocations = nullptr;
+			}
+#endif
+			return stats;
+		}
+	};
+
+	// Compile-time matcher pipeline: a list of stages, each stage is a matcher together with the pattern it finds,
+	// and the character classes that must all be present in the password for the matcher to find anything
+	template <pattern P, matcher_func M, uint8_t required_classes = 0> struct matcher_stage {};
+	template <typename... Stages> struct matcher_list {};
 
 	// Initializer functions (init.cpp)
 
 	// Database loading
 	size_t calc_decompressed_size(const uint8_t* comp_data, size_t comp_size) const;
+	std::unique_ptr<uint8_t[]> decompress(const database& db) const;
 	bool build_ranked_dicts();
 	bool build_graphs();
 	void build_graph_stats();
 	void build_l33t_table();
 	void build_sequences();
 	void build_cardinalities();
-	// Function map creation
-	void build_dict_matchers();
-	void build_matchers();
-	void build_entropy_functions();
+	void build_daymonth_table();
+	void build_char_classes();
+	void build_entropy_tables();
+	void build_cache_scope();
+	// Precomputed verdicts lookup
+	static uint64_t common_verdict_hash(const std::string& password, uint32_t seed);
+	const common_verdict* find_common_verdict(const std::string& password, const std::vector<std::string>& user_inputs) const;
+	result common_verdict_result(const std::string& password, const common_verdict& verdict) const;
+	// Matching and pruning shared by the evaluation functions
+	std::vector<std::unique_ptr<match>> find_matches(const std::string& password, const std::vector<std::string>& user_inputs, size_t per_span, std::vector<size_t>& ends, phase_timer& timer);
 
 	// Matching functions (matching.cpp)
 
@@ -136,41 +513,86 @@ private:
 	std::string translate(const std::string& password, const std::map<char, char>& chr_map) const;
 	std::string substr(const std::string& password, size_t i, size_t j) const;
 	// Complex matching
-	std::vector<std::unique_ptr<match>> omnimatch(const std::string& password) const;
+	uint8_t prescan(const std::string& password) const;
+	std::vector<std::unique_ptr<match>> omnimatch(const std::string& password, std::vector<size_t>& ends, phase_timer& timer) const;
+	static const char* matcher_name(matcher_func matcher);
+	template <pattern P, matcher_func M, uint8_t required_classes, typename... Stages> void run_matchers(matcher_list<matcher_stage<P, M, required_classes>, Stages...>, const std::string& password, uint8_t classes, std::vector<std::unique_ptr<match>>& results, phase_timer& timer) const;
+	void run_matchers(matcher_list<>, const std::string& password, uint8_t classes, std::vector<std::unique_ptr<match>>& results, phase_timer& timer) const;
+	// Stages of a parallel omnimatch: the first one runs on the evaluating thread, the others on the workers
+	struct matcher_task {
+		std::vector<std::unique_ptr<match>> matches;
+		std::vector<size_t> ends;               // number of matches by end index + 1
+		std::exception_ptr error;
+		allocation_stats allocations;           // of the task on its worker (with ZXCPPVBN_ALLOC_ACCOUNTING)
+		int64_t live_bytes;                     // allocated by the task on its worker and still live, freed by the evaluating thread
+	};
+	struct matcher_tasks {
+		std::mutex lock;
+		std::condition_variable finished;
+		size_t pending;
+		std::deque<matcher_task> tasks;
+		std::function<void()> first;
+	};
+	template <matcher_func M> void run_matcher_task(const std::string& password, uint8_t classes, matcher_task& task) const;
+	template <pattern P, matcher_func M, uint8_t required_classes, typename... Stages> void launch_matchers(matcher_list<matcher_stage<P, M, required_classes>, Stages...>, const std::string& password, uint8_t classes, matcher_tasks& tasks) const;
+	void launch_matchers(matcher_list<>, const std::string& password, uint8_t classes, matcher_tasks& tasks) const;
+	static std::vector<size_t> bucket_matches(std::vector<std::unique_ptr<match>>& matches, size_t password_size, size_t match::* position);
+	static void bucket_matches(std::vector<std::unique_ptr<match>>& matches, const std::vector<size_t>& offsets, size_t match::* position);
 	// Dictionary matching
 	std::vector<std::unique_ptr<match>> dictionary_match(const std::string& password, const std::string& dictionary) const;
+	std::vector<std::unique_ptr<match>> dictionaries_match(const std::string& password, uint8_t classes) const;
 	// L33t matching
 	std::map<char, std::vector<char>> relevent_l33t_subtable(const std::string& password) const;
-	std::vector<std::map<char, char>> enumerate_l33t_subs(const std::map<char, std::vector<char>>& table) const;
-	std::vector<std::unique_ptr<match>> l33t_match(const std::string& password) const;
+	std::vector<std::map<char, char>> enumerate_l33t_subs(const std::map<char, std::vector<char>>& table, size_t max_subs) const;
+	std::vector<std::unique_ptr<match>> l33t_match(const std::string& password, uint8_t classes) const;
 	// Spatial matching
 	std::vector<std::unique_ptr<match>> spatial_match_helper(const std::string& password, const std::string& graph_name, const std::map<char, std::vector<std::string>>& graph) const;
-	std::vector<std::unique_ptr<match>> spatial_match(const std::string& password) const;
+	std::vector<std::unique_ptr<match>> spatial_match(const std::string& password, uint8_t classes) const;
 	// Repeats and sequences matching
-	std::vector<std::unique_ptr<match>> repeat_match(const std::string& password) const;
-	std::vector<std::unique_ptr<match>> sequence_match(const std::string& password) const;
+	std::vector<std::unique_ptr<match>> repeat_match(const std::string& password, uint8_t classes) const;
+	std::vector<std::unique_ptr<match>> sequence_match(const std::string& password, uint8_t classes) const;
 	// Digits, years and dates matching
+#if ZXCPPVBN_REFERENCE_MATCHERS
 	std::vector<std::pair<size_t, size_t>> findall(const std::string& password, const std::regex& rx) const;
 	std::vector<std::tuple<size_t, size_t, std::vector<std::string>>> splitall(const std::string& password, const std::regex& rx, const std::regex& subrx) const;
 	static const std::regex digits_rx;
-	std::vector<std::unique_ptr<match>> digits_match(const std::string& password) const;
 	static const std::regex year_rx;
-	std::vector<std::unique_ptr<match>> year_match(const std::string& password) const;
-	std::vector<std::unique_ptr<match>> date_match(const std::string& password) const;
 	static const std::regex date_rx_without_sep;
-	std::vector<std::unique_ptr<match>> date_without_sep_match(const std::string& password) const;
+	std::vector<std::unique_ptr<match>> date_without_sep_match_regex(const std::string& password) const;
 	static const std::regex date_rx_year_suffix;
 	static const std::regex date_rx_year_prefix;
 	static const std::regex date_rx_split;
-	std::vector<std::unique_ptr<match>> date_sep_match(const std::string& password) const;
+	std::vector<std::unique_ptr<match>> date_sep_match_regex(const std::string& password) const;
+#endif
+	template <size_t min_len, size_t max_len> std::vector<std::pair<size_t, size_t>> scan_digits(const std::string& password) const;
+	std::vector<std::pair<size_t, size_t>> scan_years(const std::string& password) const;
+	std::vector<std::unique_ptr<match>> digits_match(const std::string& password, uint8_t classes) const;
+	std::vector<std::unique_ptr<match>> year_match(const std::string& password, uint8_t classes) const;
+	static const uint8_t date_splits[5][4][6];
+	std::vector<std::unique_ptr<match>> date_without_sep_match(const std::string& password, uint8_t classes) const;
+	typedef std::tuple<size_t /* i */, size_t /* j */, uint16_t /* year */, uint16_t /* month */, uint16_t /* day */, char /* separator */> sep_date;
+	void scan_sep_dates(const std::string& password, std::vector<sep_date>& suffix_dates, std::vector<sep_date>& prefix_dates) const;
+	std::vector<std::unique_ptr<match>> date_sep_match(const std::string& password, uint8_t classes) const;
 
 	// Scoring functions (scoring.cpp)
 
 	// Utility functions
 	uint64_t nCk(uint64_t n, uint64_t k) const;
+	uint64_t binomial_sum(size_t n, size_t k) const;
 	size_t calc_bruteforce_cardinality(const std::string& password) const;
+	size_t calc_bruteforce_cardinality(const std::string& password, size_t i, size_t j) const;
 	// Complex scoring
-	result minimum_entropy_match_sequence(const std::string& password, std::vector<std::unique_ptr<match>>& matches) const;
+	void prune_matches(std::vector<std::unique_ptr<match>>& matches, std::vector<size_t>& ends, size_t k) const;
+	struct candidate {
+		double entropy;
+		int32_t match;          // last match of the sequence (-1 - the sequence ends with a bruteforce character)
+		uint32_t previous;      // rank of the extended candidate among the candidates of the shorter prefix
+	};
+	void rank_match_sequences(const std::string& password, std::vector<std::unique_ptr<match>>& matches, const std::vector<size_t>& ends, size_t k, std::vector<candidate>& candidates, std::vector<size_t>& counts) const;
+	std::vector<size_t> decode_match_sequence(const std::vector<std::unique_ptr<match>>& matches, size_t k, const std::vector<candidate>& candidates, size_t length, size_t r) const;
+	result minimum_entropy_match_sequence(const std::string& password, std::vector<std::unique_ptr<match>>& matches, const std::vector<size_t>& ends, phase_timer& timer) const;
+	std::vector<result> k_minimum_entropy_match_sequences(const std::string& password, std::vector<std::unique_ptr<match>>& matches, const std::vector<size_t>& ends, size_t k) const;
+	result assemble_result(const std::string& password, std::vector<std::unique_ptr<match>>& match_sequence) const;
 	// Crack time constants and functions
 	static const double single_guess;
 	static const double num_attackers;
@@ -201,11 +623,38 @@ private:
 	double year_entropy(const match& match) const;
 	double date_entropy(const match& match) const;
 	bool check_date(uint16_t year, uint16_t& month, uint16_t& day) const;
+	bool check_year(uint16_t year) const;
+
+	// Matcher pipeline stages
+	typedef matcher_stage<pattern::DICTIONARY, &zxcppvbn::dictionaries_match> dictionary_stage;
+	typedef matcher_stage<pattern::L33T, &zxcppvbn::l33t_match, CHAR_L33T> l33t_stage;
+	typedef matcher_stage<pattern::SPATIAL, &zxcppvbn::spatial_match> spatial_stage;
+	typedef matcher_stage<pattern::REPEAT, &zxcppvbn::repeat_match> repeat_stage;
+	typedef matcher_stage<pattern::SEQUENCE, &zxcppvbn::sequence_match, CHAR_ALPHANUMERIC> sequence_stage;
+	typedef matcher_stage<pattern::DIGITS, &zxcppvbn::digits_match, CHAR_DIGIT> digits_stage;
+	typedef matcher_stage<pattern::YEAR, &zxcppvbn::year_match, CHAR_DIGIT> year_stage;
+	typedef matcher_stage<pattern::DATE, &zxcppvbn::date_without_sep_match, CHAR_DIGIT> date_stage;
+	typedef matcher_stage<pattern::DATE, &zxcppvbn::date_sep_match, CHAR_DIGIT | CHAR_SEPARATOR> date_sep_stage;
+
+	// Matchers invoked by omnimatch, in this order
+	// (define ZXCPPVBN_MATCHERS as a comma separated list of stages to build a variant, e.g. dictionary_stage,spatial_stage)
+#ifdef ZXCPPVBN_MATCHERS
+	typedef matcher_list<ZXCPPVBN_MATCHERS> matchers;
+#else
+	typedef matcher_list<dictionary_stage, l33t_stage, spatial_stage, repeat_stage, sequence_stage, digits_stage, year_stage, date_stage, date_sep_stage> matchers;
+#endif
 
 public:
-	zxcppvbn();
+	zxcppvbn(const options& opts = options());
 
 	result operator()(const std::string& password, const std::vector<std::string>& user_inputs = std::vector<std::string>());
+	// The k lowest entropy explanations of the password found by the scoring (which counts bruteforce characters at the
+	// cardinality of the whole password), ordered by the entropy of the results (which count each bruteforce part at its own
+	// cardinality), fewer when the password has less; with k = 1 the result of operator()
+	std::vector<result> k_best(const std::string& password, size_t k, const std::vector<std::string>& user_inputs = std::vector<std::string>());
+	std::string display_time(std::chrono::seconds crack_time) const;
+	// Only the numeric verdict of operator(), served from options::verdict_cache when possible
+	verdict estimate(const std::string& password, const std::vector<std::string>& user_inputs = std::vector<std::string>());
 };
 
 #endif